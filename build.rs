@@ -11,9 +11,11 @@ fn main() {
         .file("src/Hermite.cc")
         .file("src/KeyPair.cc")
         .file("src/LWEPrivateKey.cc")
+        .file("src/MatrixFile.cc")
         .file("src/Params.cc")
         .file("src/Plaintext.cc")
         .file("src/PrivateKey.cc")
+        .file("src/Prng.cc")
         .file("src/PublicKey.cc")
         .file("src/SchemeBase.cc")
         .file("src/SchemeletRLWEMP.cc")
@@ -63,12 +65,16 @@ fn main() {
     println!("cargo::rerun-if-changed=src/KeyPair.cc");
     println!("cargo::rerun-if-changed=src/LWEPrivateKey.h");
     println!("cargo::rerun-if-changed=src/LWEPrivateKey.cc");
+    println!("cargo::rerun-if-changed=src/MatrixFile.h");
+    println!("cargo::rerun-if-changed=src/MatrixFile.cc");
     println!("cargo::rerun-if-changed=src/Params.h");
     println!("cargo::rerun-if-changed=src/Params.cc");
     println!("cargo::rerun-if-changed=src/Plaintext.h");
     println!("cargo::rerun-if-changed=src/Plaintext.cc");
     println!("cargo::rerun-if-changed=src/PrivateKey.h");
     println!("cargo::rerun-if-changed=src/PrivateKey.cc");
+    println!("cargo::rerun-if-changed=src/Prng.h");
+    println!("cargo::rerun-if-changed=src/Prng.cc");
     println!("cargo::rerun-if-changed=src/PublicKey.h");
     println!("cargo::rerun-if-changed=src/PublicKey.cc");
     println!("cargo::rerun-if-changed=src/SchemeBase.h");
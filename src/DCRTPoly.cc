@@ -1,36 +1,637 @@
 #include "DCRTPoly.h"
+#include "MatrixFile.h"
+#include "Prng.h"
+#include "SerialDeserial.h"
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <future>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace openfhe
 {
     namespace
     {
-        lbcrypto::BigInteger BigIntegerFromFixedLimbsLE(const uint64_t *limbs, size_t limbsPerInt)
+        // 2^(64 i) mod q for every limb position together with the Shoup companions used by
+        // ModMulFastConst, which accepts any 64-bit multiplicand, so limbs are never pre-reduced.
+        struct LimbWeights
+        {
+            std::vector<lbcrypto::NativeInteger> weights;
+            std::vector<lbcrypto::NativeInteger> precons;
+        };
+
+        LimbWeights ComputeLimbWeights(const lbcrypto::NativeInteger &q, size_t limbsPerInt)
+        {
+            LimbWeights table;
+            table.weights.reserve(limbsPerInt);
+            table.precons.reserve(limbsPerInt);
+
+            const uint64_t modulus = q.ConvertToInt<uint64_t>();
+            const uint64_t two64ModQ = static_cast<uint64_t>((static_cast<unsigned __int128>(1) << 64) % modulus);
+            uint64_t weight = 1 % modulus;
+            for (size_t i = 0; i < limbsPerInt; ++i)
+            {
+                table.weights.emplace_back(weight);
+                table.precons.push_back(table.weights.back().PrepModMulConst(q));
+                weight = static_cast<uint64_t>(
+                    (static_cast<unsigned __int128>(weight) * two64ModQ) % modulus);
+            }
+            return table;
+        }
+
+        // Builds the towers directly from fixed-width little-endian integers: every tower gets
+        // sum_i limb_i * (2^(64 i) mod q_j) mod q_j, without any BigInteger or BigVector.
+        lbcrypto::DCRTPoly DCRTPolyFromFixedLimbsLE(
+            const CRTBasis &basis,
+            const Format format,
+            const uint64_t *values,
+            size_t count,
+            size_t limbsPerInt)
+        {
+            const auto &params = basis.GetParams();
+            const size_t ringDim = params->GetRingDimension();
+            const size_t limit = (count < ringDim) ? count : ringDim;
+            const auto &towerParams = params->GetParams();
+            const rust::Slice<const uint64_t> moduli = basis.GetModuli();
+
+            lbcrypto::DCRTPoly result(params, format);
+            for (size_t t = 0; t < towerParams.size(); ++t)
+            {
+                const lbcrypto::NativeInteger q(moduli[t]);
+                const LimbWeights table = ComputeLimbWeights(q, limbsPerInt);
+
+                lbcrypto::NativeVector residues(ringDim, q);
+#pragma omp parallel for if (limit > 1024)
+                for (long iL = 0; iL < static_cast<long>(limit); ++iL)
+                {
+                    const size_t i = static_cast<size_t>(iL);
+                    const uint64_t *limbs = values + (i * limbsPerInt);
+                    lbcrypto::NativeInteger acc(0);
+                    for (size_t l = 0; l < limbsPerInt; ++l)
+                    {
+                        if (limbs[l] != 0)
+                        {
+                            acc.ModAddFastEq(lbcrypto::NativeInteger(limbs[l]).ModMulFastConst(
+                                                 table.weights[l], q, table.precons[l]),
+                                             q);
+                        }
+                    }
+                    residues[i] = acc;
+                }
+
+                lbcrypto::DCRTPoly::PolyType tower(towerParams[t], format);
+                tower.SetValues(std::move(residues), format);
+                result.SetElementAtIndex(t, std::move(tower));
+            }
+            return result;
+        }
+
+        static_assert(sizeof(lbcrypto::NativeInteger) == sizeof(uint64_t),
+                      "NativeVector storage must be reinterpretable as u64 residues");
+
+        bool TowerIsEmpty(const lbcrypto::DCRTPoly::PolyType &tower)
+        {
+            return tower.IsEmpty() || tower.GetLength() == 0;
+        }
+
+        // Residue storage of a tower; nullptr for a default-constructed or zero-length tower,
+        // which has no element 0 to take the address of
+        const uint64_t *TowerData(const lbcrypto::DCRTPoly::PolyType &tower)
+        {
+            if (TowerIsEmpty(tower))
+            {
+                return nullptr;
+            }
+            return reinterpret_cast<const uint64_t *>(&tower.GetValues()[0]);
+        }
+
+        uint64_t *MutableTowerData(lbcrypto::DCRTPoly::PolyType &tower)
+        {
+            if (TowerIsEmpty(tower))
+            {
+                return nullptr;
+            }
+            return reinterpret_cast<uint64_t *>(&tower[0]);
+        }
+
+        // Returns `poly` itself when already in COEFFICIENT format, otherwise a converted copy
+        // held in `scratch`.
+        const lbcrypto::DCRTPoly &InCoefficientFormat(const lbcrypto::DCRTPoly &poly, lbcrypto::DCRTPoly &scratch)
+        {
+            if (poly.GetFormat() == Format::COEFFICIENT)
+            {
+                return poly;
+            }
+            scratch = poly;
+            scratch.SetFormat(Format::COEFFICIENT);
+            return scratch;
+        }
+
+        lbcrypto::BigInteger BigIntegerFromLimbsLE(rust::Slice<const uint64_t> limbs)
         {
             lbcrypto::BigInteger result(0);
-            if (limbsPerInt == 0)
+            for (size_t i = limbs.size(); i-- > 0;)
             {
-                return result;
+                result <<= 64;
+                result += lbcrypto::BigInteger(limbs[i]);
             }
+            return result;
+        }
 
-            lbcrypto::BigInteger factor(1);
-            for (size_t i = 0; i < limbsPerInt; ++i)
+        // Same ring dimension and the same modulus in every tower
+        void CheckSameTowers(const lbcrypto::DCRTPoly &lhs, const lbcrypto::DCRTPoly &rhs)
+        {
+            const size_t towers = lhs.GetNumOfElements();
+            if (towers != rhs.GetNumOfElements() || lhs.GetRingDimension() != rhs.GetRingDimension())
+            {
+                throw std::runtime_error("DCRTPoly operands have different ring dimension or towers");
+            }
+            for (size_t t = 0; t < towers; ++t)
+            {
+                if (lhs.GetElementAtIndex(t).GetModulus() != rhs.GetElementAtIndex(t).GetModulus())
+                {
+                    throw std::runtime_error("DCRTPoly operands have different tower moduli");
+                }
+            }
+        }
+
+        // Little-endian u64 limbs of a BigInteger, truncated or zero-padded to `limbs`.
+        void BigIntegerToLimbsLE(const lbcrypto::BigInteger &value, size_t limbs, uint64_t *out)
+        {
+            const lbcrypto::BigInteger two64 = lbcrypto::BigInteger(1) << 64;
+            lbcrypto::BigInteger rest = value;
+            for (size_t i = 0; i < limbs; ++i)
+            {
+                out[i] = rest.Mod(two64).ConvertToInt<uint64_t>();
+                rest >>= 64;
+            }
+        }
+
+        // acc[0..len] += a[0..len) * y; acc carries one extra limb.
+        inline void MulAddLimbs(uint64_t *acc, const uint64_t *a, size_t len, uint64_t y)
+        {
+            unsigned __int128 carry = 0;
+            for (size_t j = 0; j < len; ++j)
+            {
+                const unsigned __int128 cur = static_cast<unsigned __int128>(a[j]) * y + acc[j] + carry;
+                acc[j] = static_cast<uint64_t>(cur);
+                carry = cur >> 64;
+            }
+            acc[len] += static_cast<uint64_t>(carry);
+        }
+
+        // acc[0..len] -= a[0..len) * v; the caller guarantees the result is non-negative.
+        inline void SubMulLimbs(uint64_t *acc, const uint64_t *a, size_t len, uint64_t v)
+        {
+            unsigned __int128 carry = 0;
+            uint64_t borrow = 0;
+            for (size_t j = 0; j < len; ++j)
             {
-                const uint64_t limb = limbs[i];
-                if (limb != 0)
+                const unsigned __int128 prod = static_cast<unsigned __int128>(a[j]) * v + carry;
+                const uint64_t lo = static_cast<uint64_t>(prod);
+                carry = prod >> 64;
+                const uint64_t diff = acc[j] - lo;
+                const uint64_t borrowLo = acc[j] < lo;
+                acc[j] = diff - borrow;
+                borrow = borrowLo + (diff < borrow);
+            }
+            acc[len] -= static_cast<uint64_t>(carry) + borrow;
+        }
+
+        // acc[0..len] >= a[0..len)
+        inline bool GeqLimbs(const uint64_t *acc, const uint64_t *a, size_t len)
+        {
+            if (acc[len] != 0)
+            {
+                return true;
+            }
+            for (size_t j = len; j-- > 0;)
+            {
+                if (acc[j] != a[j])
                 {
-                    result += lbcrypto::BigInteger(limb) * factor;
+                    return acc[j] > a[j];
                 }
-                factor <<= 64;
+            }
+            return true;
+        }
+
+        template <typename MatrixLike>
+        void CheckEvaluationMatrix(const MatrixLike &matrix)
+        {
+            for (size_t i = 0; i < matrix.GetRows(); ++i)
+            {
+                for (size_t j = 0; j < matrix.GetCols(); ++j)
+                {
+                    if (matrix(i, j).GetFormat() != Format::EVALUATION)
+                    {
+                        throw std::runtime_error("matrix operands must be in EVALUATION format");
+                    }
+                }
+            }
+        }
+
+        // Coefficients processed per pass of the inner-product loop; 256 128-bit accumulators
+        // stay in L1 while the k dimension streams through.
+        constexpr size_t kMatrixMulCoeffTile = 256;
+
+        // C(i, j) (+)= sum_k A(i, k) * B(k, j), one (i, j, tower) triple per work item. Products are
+        // summed in 128-bit lanes and only reduced when another term could overflow them.
+        // Operands may be a Matrix or a MatrixView.
+        template <typename LhsMatrix, typename RhsMatrix>
+        void MatrixMulInto(const LhsMatrix &a, const RhsMatrix &b, Matrix &c, bool accumulate)
+        {
+            const size_t rows = a.GetRows();
+            const size_t inner = a.GetCols();
+            const size_t cols = b.GetCols();
+            const lbcrypto::DCRTPoly &first = a(0, 0);
+            const size_t towers = first.GetNumOfElements();
+            const size_t ringDim = first.GetRingDimension();
+
+            std::vector<uint64_t> moduli(towers);
+            std::vector<size_t> flushEvery(towers);
+            for (size_t t = 0; t < towers; ++t)
+            {
+                const lbcrypto::NativeInteger &q = first.GetElementAtIndex(t).GetModulus();
+                moduli[t] = q.ConvertToInt<uint64_t>();
+                const size_t headroom = 127 - (2 * q.GetMSB());
+                flushEvery[t] = headroom >= 32 ? (size_t(1) << 32) : (size_t(1) << headroom);
+            }
+
+            const size_t items = rows * cols * towers;
+#pragma omp parallel for schedule(dynamic) if (items > 1)
+            for (long itemL = 0; itemL < static_cast<long>(items); ++itemL)
+            {
+                const size_t item = static_cast<size_t>(itemL);
+                const size_t t = item % towers;
+                const size_t j = (item / towers) % cols;
+                const size_t i = item / (towers * cols);
+                const uint64_t q = moduli[t];
+
+                lbcrypto::DCRTPoly::PolyType &outTower = c(i, j).GetAllElements()[t];
+                uint64_t *dst = MutableTowerData(outTower);
+
+                unsigned __int128 acc[kMatrixMulCoeffTile];
+                for (size_t base = 0; base < ringDim; base += kMatrixMulCoeffTile)
+                {
+                    const size_t len = std::min(kMatrixMulCoeffTile, ringDim - base);
+                    for (size_t x = 0; x < len; ++x)
+                    {
+                        acc[x] = accumulate ? dst[base + x] : 0;
+                    }
+
+                    size_t pending = 0;
+                    for (size_t k = 0; k < inner; ++k)
+                    {
+                        const uint64_t *lhs = TowerData(a(i, k).GetElementAtIndex(t)) + base;
+                        const uint64_t *rhs = TowerData(b(k, j).GetElementAtIndex(t)) + base;
+                        for (size_t x = 0; x < len; ++x)
+                        {
+                            acc[x] += static_cast<unsigned __int128>(lhs[x]) * rhs[x];
+                        }
+                        if (++pending == flushEvery[t])
+                        {
+                            for (size_t x = 0; x < len; ++x)
+                            {
+                                acc[x] %= q;
+                            }
+                            pending = 0;
+                        }
+                    }
+
+                    for (size_t x = 0; x < len; ++x)
+                    {
+                        dst[base + x] = static_cast<uint64_t>(acc[x] % q);
+                    }
+                }
+            }
+        }
+
+        // MatrixMulInto sizes its per-tower tables from one entry, so every entry must share its
+        // towers; mixed-tower matrices are rejected here rather than read out of bounds
+        template <typename MatrixLike>
+        void CheckUniformTowers(const MatrixLike &matrix, const lbcrypto::DCRTPoly &reference)
+        {
+            for (size_t i = 0; i < matrix.GetRows(); ++i)
+            {
+                for (size_t j = 0; j < matrix.GetCols(); ++j)
+                {
+                    CheckSameTowers(reference, matrix(i, j));
+                }
+            }
+        }
+
+        template <typename LhsMatrix, typename RhsMatrix>
+        void CheckMatrixMulShapes(const LhsMatrix &a, const RhsMatrix &b)
+        {
+            if (a.GetCols() != b.GetRows())
+            {
+                throw std::runtime_error("matrix dimensions do not match for multiplication");
+            }
+            if (a.GetRows() == 0 || a.GetCols() == 0 || b.GetCols() == 0)
+            {
+                throw std::runtime_error("matrix dimensions must be non-zero");
+            }
+            CheckEvaluationMatrix(a);
+            CheckEvaluationMatrix(b);
+            CheckUniformTowers(a, a(0, 0));
+            CheckUniformTowers(b, a(0, 0));
+        }
+
+        // Applies `op(result(i, j), a(i, j), b(i, j))` over every entry in parallel.
+        template <typename Op>
+        std::unique_ptr<Matrix> MatrixElementwise(const Matrix &a, const Matrix &b, Op op)
+        {
+            if (a.GetRows() != b.GetRows() || a.GetCols() != b.GetCols())
+            {
+                throw std::runtime_error("matrix dimensions do not match");
+            }
+            CheckEvaluationMatrix(a);
+            CheckEvaluationMatrix(b);
+            const size_t cols = a.GetCols();
+            const size_t entries = a.GetRows() * cols;
+            // OpenFHE's operators neither check towers nor may throw inside the region
+            for (size_t e = 0; e < entries; ++e)
+            {
+                CheckSameTowers(a(e / cols, e % cols), b(e / cols, e % cols));
+            }
+
+            auto result = std::make_unique<Matrix>(a);
+#pragma omp parallel for if (entries > 1)
+            for (long eL = 0; eL < static_cast<long>(entries); ++eL)
+            {
+                const size_t e = static_cast<size_t>(eL);
+                op((*result)(e / cols, e % cols), b(e / cols, e % cols));
             }
             return result;
         }
+
+        // Digits of one residue in base 2^baseBits, as NativePoly::BaseDecompose counts them
+        size_t TowerDigitCount(const lbcrypto::NativeInteger &q, uint32_t baseBits)
+        {
+            return (q.GetMSB() + baseBits - 1) / baseBits;
+        }
+
+        // Index of the first digit of every tower in the tower-major digit order, plus the total
+        std::vector<size_t> TowerDigitOffsets(const lbcrypto::DCRTPoly::Params &params, uint32_t baseBits)
+        {
+            if (baseBits == 0 || baseBits >= 64)
+            {
+                throw std::runtime_error("baseBits must be in [1, 63]");
+            }
+
+            std::vector<size_t> offsets(1, 0);
+            for (const auto &towerParams : params.GetParams())
+            {
+                offsets.push_back(offsets.back() + TowerDigitCount(towerParams->GetModulus(), baseBits));
+            }
+            return offsets;
+        }
+
+        // Digits of tower t of `coeff` (COEFFICIENT format), written to slot(first + j) for digit j.
+        // A digit is a residue mod q_t, so like CRTDecompose's SwitchModulus it is centred
+        // against q_t and then reduced into every other tower; with baseBits close to the tower
+        // width a digit can exceed q_t / 2 or a smaller tower modulus.
+        template <typename Slot>
+        void DecomposeTowerInto(
+            const lbcrypto::DCRTPoly &coeff,
+            size_t t,
+            size_t first,
+            uint32_t baseBits,
+            Format format,
+            Slot slot)
+        {
+            const auto &params = coeff.GetParams();
+            const size_t ringDim = params->GetRingDimension();
+            const lbcrypto::NativeVector &x = coeff.GetElementAtIndex(t).GetValues();
+            const lbcrypto::NativeInteger &q = params->GetParams()[t]->GetModulus();
+            const size_t digits = TowerDigitCount(q, baseBits);
+            const uint64_t mask = (uint64_t(1) << baseBits) - 1;
+            const uint64_t qt = q.ConvertToInt<uint64_t>();
+
+            std::vector<uint64_t> residues(ringDim);
+            for (size_t i = 0; i < ringDim; i++)
+            {
+                residues[i] = x[i].ConvertToInt<uint64_t>();
+            }
+
+            std::vector<int64_t> digit(ringDim);
+            for (size_t j = 0; j < digits; j++)
+            {
+                const uint32_t shift = static_cast<uint32_t>(j) * baseBits;
+                for (size_t i = 0; i < ringDim; i++)
+                {
+                    // below q_t, since either 2^baseBits <= q_t or the digit is the whole residue
+                    const uint64_t d = (residues[i] >> shift) & mask;
+                    digit[i] = d > qt / 2 ? -static_cast<int64_t>(qt - d) : static_cast<int64_t>(d);
+                }
+                slot(first + j) = DCRTPolyFromSmallIntegers(
+                    params, format, rust::Slice<const int64_t>(digit.data(), digit.size()));
+            }
+        }
+
+        void CheckGadgetBase(int64_t base)
+        {
+            if (base < 2 || base > INT32_MAX)
+            {
+                throw std::runtime_error("gadget base must be in [2, 2^31)");
+            }
+        }
+
+        // Digits per tower of the CRT gadget g = (1, b, ..., b^(D-1)) in every tower: the smallest D
+        // with b^D >= the largest tower modulus, plus one carry digit when balanced.
+        size_t GadgetTowerDigits(const lbcrypto::DCRTPoly::Params &params, int64_t base, bool balanced)
+        {
+            CheckGadgetBase(base);
+
+            uint64_t maxModulus = 0;
+            for (const auto &towerParams : params.GetParams())
+            {
+                maxModulus = std::max(maxModulus, towerParams->GetModulus().ConvertToInt<uint64_t>());
+            }
+
+            // base-b length of maxModulus - 1
+            const uint64_t b = static_cast<uint64_t>(base);
+            size_t digits = 1;
+            for (uint64_t rest = maxModulus - 1; rest >= b; rest /= b)
+            {
+                digits++;
+            }
+            return balanced ? digits + 1 : digits;
+        }
+
+        // Base-`base` digits of tower t of `coeff` (COEFFICIENT format), written to
+        // slot(first + j) for digit j. Balanced digits lie in (-b/2, b/2] and start from the
+        // centred residue; the last digit takes whatever carry is left so the sum is exact.
+        template <typename Slot>
+        void GadgetDecomposeTowerInto(
+            const lbcrypto::DCRTPoly &coeff,
+            size_t t,
+            size_t first,
+            size_t digits,
+            int64_t base,
+            bool balanced,
+            Format format,
+            Slot slot)
+        {
+            const auto &params = coeff.GetParams();
+            const size_t ringDim = params->GetRingDimension();
+            const lbcrypto::NativeVector &x = coeff.GetElementAtIndex(t).GetValues();
+            const uint64_t q = params->GetParams()[t]->GetModulus().ConvertToInt<uint64_t>();
+
+            // residues as signed remainders; digit extraction then runs lane-wise over n
+            std::vector<int64_t> rest(ringDim);
+            for (size_t i = 0; i < ringDim; i++)
+            {
+                const uint64_t r = x[i].ConvertToInt<uint64_t>();
+                rest[i] = balanced && r > q / 2 ? -static_cast<int64_t>(q - r) : static_cast<int64_t>(r);
+            }
+
+            const bool pow2 = (base & (base - 1)) == 0;
+            const int shift = pow2 ? __builtin_ctzll(static_cast<uint64_t>(base)) : 0;
+            const int64_t mask = base - 1;
+            const int64_t half = base / 2;
+
+            std::vector<int64_t> digit(ringDim);
+            for (size_t j = 0; j < digits; j++)
+            {
+                if (j + 1 == digits)
+                {
+                    digit.swap(rest);
+                }
+                else if (pow2)
+                {
+                    // arithmetic shift keeps rest - d divisible by b for negative values
+                    for (size_t i = 0; i < ringDim; i++)
+                    {
+                        int64_t d = rest[i] & mask;
+                        d -= balanced && d > half ? base : 0;
+                        digit[i] = d;
+                        rest[i] = (rest[i] - d) >> shift;
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < ringDim; i++)
+                    {
+                        int64_t d = rest[i] % base;
+                        d += d < 0 ? base : 0;
+                        d -= balanced && d > half ? base : 0;
+                        digit[i] = d;
+                        rest[i] = (rest[i] - d) / base;
+                    }
+                }
+                slot(first + j) = DCRTPolyFromSmallIntegers(
+                    params, format, rust::Slice<const int64_t>(digit.data(), digit.size()));
+            }
+        }
+
+        // b^l mod q_t with Shoup companions for l < digits, per tower: the non-zero entries of the
+        // CRT gadget row of length towers * digits.
+        struct GadgetPowers
+        {
+            std::vector<std::vector<lbcrypto::NativeInteger>> powers;
+            std::vector<std::vector<lbcrypto::NativeInteger>> precons;
+        };
+
+        GadgetPowers ComputeGadgetPowers(const lbcrypto::DCRTPoly::Params &params, int64_t base, size_t len)
+        {
+            const auto &towerParams = params.GetParams();
+            CheckGadgetBase(base);
+            if (len == 0 || len % towerParams.size() != 0)
+            {
+                throw std::runtime_error("gadget length must be a non-zero multiple of the tower count");
+            }
+
+            const size_t digits = len / towerParams.size();
+            GadgetPowers table;
+            for (const auto &tower : towerParams)
+            {
+                const lbcrypto::NativeInteger &q = tower->GetModulus();
+                const lbcrypto::NativeInteger b = lbcrypto::NativeInteger(static_cast<uint64_t>(base)).Mod(q);
+                std::vector<lbcrypto::NativeInteger> powers;
+                std::vector<lbcrypto::NativeInteger> precons;
+                lbcrypto::NativeInteger power = lbcrypto::NativeInteger(1).Mod(q);
+                for (size_t l = 0; l < digits; l++)
+                {
+                    powers.push_back(power);
+                    precons.push_back(power.PrepModMulConst(q));
+                    power = power.ModMul(b, q);
+                }
+                table.powers.push_back(std::move(powers));
+                table.precons.push_back(std::move(precons));
+            }
+            return table;
+        }
+
+        // Pointers to every entry of `matrix` in COEFFICIENT format, row-major; entries that are
+        // not already in that format are converted into `scratch`
+        std::vector<const lbcrypto::DCRTPoly *> CoefficientEntries(
+            const Matrix &matrix,
+            std::vector<lbcrypto::DCRTPoly> &scratch)
+        {
+            const size_t cols = matrix.GetCols();
+            const size_t entries = matrix.GetRows() * cols;
+            scratch.resize(entries);
+            std::vector<const lbcrypto::DCRTPoly *> coeffs(entries);
+#pragma omp parallel for if (entries > 1)
+            for (long eL = 0; eL < static_cast<long>(entries); ++eL)
+            {
+                const size_t e = static_cast<size_t>(eL);
+                coeffs[e] = &InCoefficientFormat(matrix(e / cols, e % cols), scratch[e]);
+            }
+            return coeffs;
+        }
+
+        using ParamsKey = std::tuple<usint, size_t, size_t>;
+
+        std::mutex &ParamsCacheMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        // One future per key: the first caller builds the params outside the mutex while later
+        // callers for the same key wait on the future, and other keys are not blocked
+        using CachedBasis = std::shared_future<std::shared_ptr<CRTBasis>>;
+
+        std::map<ParamsKey, CachedBasis> &ParamsCache()
+        {
+            static std::map<ParamsKey, CachedBasis> cache;
+            return cache;
+        }
+
+        // Params ParamsCache owns, by identity. Each entry keeps its params alive and is dropped
+        // together with the cache, so an address is never reused while indexed.
+        std::map<const lbcrypto::DCRTPoly::Params *, std::shared_ptr<CRTBasis>> &OwnedBasisIndex()
+        {
+            static std::map<const lbcrypto::DCRTPoly::Params *, std::shared_ptr<CRTBasis>> index;
+            return index;
+        }
+
+        // Bumped under ParamsCacheMutex by every clear, so bases built or memoised before it are
+        // neither indexed nor served afterwards
+        std::atomic<uint64_t> g_paramsCacheGeneration{0};
     } // namespace
 
     DCRTPoly::DCRTPoly(lbcrypto::DCRTPoly &&poly) noexcept
-        : m_poly(std::move(poly))
+        : m_owned(std::move(poly)), m_poly(m_owned)
+    {
+    }
+
+    DCRTPoly::DCRTPoly(Borrowed, lbcrypto::DCRTPoly &poly) noexcept
+        : m_poly(poly)
+    {
+    }
+
+    DCRTPoly::DCRTPoly(Borrowed, const lbcrypto::DCRTPoly &poly) noexcept
+        : m_poly(const_cast<lbcrypto::DCRTPoly &>(poly))
     {
     }
 
@@ -39,6 +640,26 @@ namespace openfhe
         return m_poly;
     }
 
+    lbcrypto::DCRTPoly &DCRTPoly::GetPoly() noexcept
+    {
+        return m_poly;
+    }
+
+    std::unique_ptr<DCRTPoly> DCRTPoly::Borrow(const lbcrypto::DCRTPoly &poly)
+    {
+        return std::make_unique<DCRTPoly>(Borrowed{}, poly);
+    }
+
+    std::unique_ptr<DCRTPoly> DCRTPoly::Borrow(lbcrypto::DCRTPoly &poly)
+    {
+        return std::make_unique<DCRTPoly>(Borrowed{}, poly);
+    }
+
+    bool DCRTPoly::IsBorrowed() const noexcept
+    {
+        return &m_poly != &m_owned;
+    }
+
     rust::String DCRTPoly::GetString() const
     {
         std::stringstream stream;
@@ -58,10 +679,8 @@ namespace openfhe
 
     rust::Vec<rust::String> DCRTPoly::GetCoefficients() const
     {
-        auto tempPoly = m_poly;
-        tempPoly.SetFormat(Format::COEFFICIENT);
-
-        lbcrypto::DCRTPoly::PolyLargeType polyLarge = tempPoly.CRTInterpolate();
+        lbcrypto::DCRTPoly scratch;
+        lbcrypto::DCRTPoly::PolyLargeType polyLarge = InCoefficientFormat(m_poly, scratch).CRTInterpolate();
 
         const lbcrypto::BigVector &coeffs = polyLarge.GetValues();
 
@@ -76,31 +695,173 @@ namespace openfhe
 
     rust::Vec<rust::u8> DCRTPoly::GetCoefficientsBytes() const
     {
-        auto tempPoly = m_poly;
-        tempPoly.SetFormat(Format::COEFFICIENT);
-
-        lbcrypto::DCRTPoly::PolyLargeType polyLarge = tempPoly.CRTInterpolate();
+        lbcrypto::DCRTPoly scratch;
+        lbcrypto::DCRTPoly::PolyLargeType polyLarge = InCoefficientFormat(m_poly, scratch).CRTInterpolate();
 
         const lbcrypto::BigVector &coeffs = polyLarge.GetValues();
 
-        // Serialize the coefficients to a binary format
-        std::stringstream ss;
-        lbcrypto::Serial::Serialize(coeffs, ss, lbcrypto::SerType::BINARY);
+        return SerializeObjectToBytes(coeffs, SerialMode::BINARY);
+    }
+
+    size_t DCRTPoly::GetNumOfTowers() const noexcept
+    {
+        return m_poly.GetNumOfElements();
+    }
 
-        // Get the binary data as a string
-        std::string serializedData = ss.str();
+    size_t DCRTPoly::GetRingDimension() const noexcept
+    {
+        return m_poly.GetRingDimension();
+    }
 
-        // Convert to a rust::Vec<rust::u8>
-        rust::Vec<rust::u8> result;
-        result.reserve(serializedData.size());
+    Format DCRTPoly::GetFormat() const noexcept
+    {
+        return m_poly.GetFormat();
+    }
 
-        // Copy each byte from the serialized data to the result vector
-        for (size_t i = 0; i < serializedData.size(); ++i)
+    rust::Slice<const uint64_t> DCRTPoly::GetTowerValues(size_t towerIdx) const
+    {
+        if (towerIdx >= m_poly.GetNumOfElements())
         {
-            result.push_back(static_cast<rust::u8>(static_cast<unsigned char>(serializedData[i])));
+            throw std::out_of_range("tower index out of range");
         }
+        const lbcrypto::DCRTPoly::PolyType &tower = m_poly.GetElementAtIndex(towerIdx);
+        if (TowerIsEmpty(tower))
+        {
+            return rust::Slice<const uint64_t>();
+        }
+        return rust::Slice<const uint64_t>(TowerData(tower), tower.GetLength());
+    }
 
-        return result;
+    void DCRTPoly::WriteTowersInto(Format format, rust::Slice<uint64_t> out) const
+    {
+        const size_t towers = m_poly.GetNumOfElements();
+        const size_t ringDim = m_poly.GetRingDimension();
+        if (out.size() != towers * ringDim)
+        {
+            throw std::runtime_error("out length must equal size * n");
+        }
+
+#pragma omp parallel for if (towers > 1)
+        for (long tL = 0; tL < static_cast<long>(towers); ++tL)
+        {
+            const size_t t = static_cast<size_t>(tL);
+            uint64_t *dst = out.data() + (t * ringDim);
+            const lbcrypto::DCRTPoly::PolyType &tower = m_poly.GetElementAtIndex(t);
+            if (m_poly.GetFormat() == format)
+            {
+                std::memcpy(dst, TowerData(tower), ringDim * sizeof(uint64_t));
+            }
+            else
+            {
+                // Only the tower being written is copied for the domain switch
+                lbcrypto::DCRTPoly::PolyType converted = tower;
+                converted.SetFormat(format);
+                std::memcpy(dst, TowerData(converted), ringDim * sizeof(uint64_t));
+            }
+        }
+    }
+
+    void DCRTPoly::WriteCoefficientsLimbsInto(size_t limbsPerInt, rust::Slice<uint64_t> out) const
+    {
+        const size_t towers = m_poly.GetNumOfElements();
+        const size_t ringDim = m_poly.GetRingDimension();
+        if (out.size() != ringDim * limbsPerInt)
+        {
+            throw std::runtime_error("out length must equal n * limbs_per_int");
+        }
+
+        const std::shared_ptr<CRTBasis> basis = GetCRTBasis(m_poly.GetParams());
+        const size_t modulusLimbs = basis->GetModulusLimbs().size();
+        if (limbsPerInt < modulusLimbs)
+        {
+            throw std::runtime_error("limbs_per_int is too small for the modulus");
+        }
+
+        lbcrypto::DCRTPoly scratch;
+        const lbcrypto::DCRTPoly *source = &InCoefficientFormat(m_poly, scratch);
+
+        std::vector<const uint64_t *> residues(towers);
+        for (size_t t = 0; t < towers; ++t)
+        {
+            residues[t] = TowerData(source->GetElementAtIndex(t));
+        }
+        const rust::Slice<const uint64_t> moduli = basis->GetModuli();
+        const rust::Slice<const uint64_t> modulus = basis->GetModulusLimbs();
+        const rust::Slice<const uint64_t> qHat = basis->GetQHat();
+        const std::vector<lbcrypto::NativeInteger> &qHatInv = basis->GetQHatInvNative();
+        const std::vector<lbcrypto::NativeInteger> &qHatInvPrecon = basis->GetQHatInvPrecon();
+        const std::vector<double> &qInv = basis->GetQInv();
+
+        // x = sum_t [x_t * (Q/q_t)^-1]_{q_t} * (Q/q_t) - v * Q, with v estimated in floating
+        // point one below its true value and fixed up by at most a couple of subtractions.
+#pragma omp parallel if (ringDim > 256)
+        {
+            std::vector<uint64_t> acc(modulusLimbs + 1);
+#pragma omp for
+            for (long iL = 0; iL < static_cast<long>(ringDim); ++iL)
+            {
+                const size_t i = static_cast<size_t>(iL);
+                std::fill(acc.begin(), acc.end(), 0);
+
+                double quotient = 0.0;
+                for (size_t t = 0; t < towers; ++t)
+                {
+                    const uint64_t y = lbcrypto::NativeInteger(residues[t][i])
+                                           .ModMulFastConst(qHatInv[t], lbcrypto::NativeInteger(moduli[t]), qHatInvPrecon[t])
+                                           .ConvertToInt<uint64_t>();
+                    MulAddLimbs(acc.data(), &qHat[t * modulusLimbs], modulusLimbs, y);
+                    quotient += static_cast<double>(y) * qInv[t];
+                }
+
+                uint64_t v = static_cast<uint64_t>(quotient);
+                if (v > 0)
+                {
+                    --v;
+                }
+                SubMulLimbs(acc.data(), modulus.data(), modulusLimbs, v);
+                while (GeqLimbs(acc.data(), modulus.data(), modulusLimbs))
+                {
+                    SubMulLimbs(acc.data(), modulus.data(), modulusLimbs, 1);
+                }
+
+                uint64_t *dst = out.data() + (i * limbsPerInt);
+                std::copy(acc.begin(), acc.begin() + modulusLimbs, dst);
+                std::fill(dst + modulusLimbs, dst + limbsPerInt, 0);
+            }
+        }
+    }
+
+    void DCRTPoly::SetFormat(Format format)
+    {
+        m_poly.SetFormat(format);
+    }
+
+    void DCRTPoly::AddAssign(const DCRTPoly &rhs)
+    {
+        CheckSameTowers(m_poly, rhs.m_poly);
+        m_poly += rhs.m_poly;
+    }
+
+    void DCRTPoly::SubAssign(const DCRTPoly &rhs)
+    {
+        CheckSameTowers(m_poly, rhs.m_poly);
+        m_poly -= rhs.m_poly;
+    }
+
+    void DCRTPoly::MulAssign(const DCRTPoly &rhs)
+    {
+        CheckSameTowers(m_poly, rhs.m_poly);
+        m_poly *= rhs.m_poly;
+    }
+
+    void DCRTPoly::ScalarMulAssign(uint64_t scalar)
+    {
+        m_poly *= lbcrypto::BigInteger(scalar);
+    }
+
+    void DCRTPoly::ScalarMulLimbsAssign(rust::Slice<const uint64_t> scalarLimbs)
+    {
+        m_poly *= BigIntegerFromLimbsLE(scalarLimbs);
     }
 
     std::unique_ptr<DCRTPoly> DCRTPoly::Negate() const
@@ -123,6 +884,43 @@ namespace openfhe
         return std::make_unique<Matrix>(std::move(decomposedMatrix));
     }
 
+    size_t DCRTPoly::GetDecomposeLength(uint32_t baseBits) const
+    {
+        return TowerDigitOffsets(*m_poly.GetParams(), baseBits).back();
+    }
+
+    void DCRTPoly::DecomposeInto(
+        uint32_t baseBits,
+        Matrix &out,
+        size_t row,
+        size_t col,
+        bool column,
+        Format format) const
+    {
+        const std::vector<size_t> offsets = TowerDigitOffsets(*m_poly.GetParams(), baseBits);
+        const size_t length = offsets.back();
+        const size_t rows = out.GetRows();
+        const size_t cols = out.GetCols();
+        if (column ? (row > rows || length > rows - row || col >= cols)
+                   : (row >= rows || col > cols || length > cols - col))
+        {
+            throw std::out_of_range("decomposition does not fit in the output matrix");
+        }
+
+        lbcrypto::DCRTPoly scratch;
+        const lbcrypto::DCRTPoly &coeff = InCoefficientFormat(m_poly, scratch);
+        auto slot = [&](size_t digit) -> lbcrypto::DCRTPoly &
+        { return column ? out(row + digit, col) : out(row, col + digit); };
+
+        const size_t towers = offsets.size() - 1;
+#pragma omp parallel for if (towers > 1)
+        for (long tL = 0; tL < static_cast<long>(towers); ++tL)
+        {
+            const size_t t = static_cast<size_t>(tL);
+            DecomposeTowerInto(coeff, t, offsets[t], baseBits, format, slot);
+        }
+    }
+
     // Arithmetic
     std::unique_ptr<DCRTPoly> DCRTPolyAdd(const DCRTPoly &rhs, const DCRTPoly &lhs)
     {
@@ -134,6 +932,56 @@ namespace openfhe
         return std::make_unique<DCRTPoly>(rhs.GetPoly() * lhs.GetPoly());
     }
 
+    std::unique_ptr<DCRTPoly> DCRTPolySub(const DCRTPoly &lhs, const DCRTPoly &rhs)
+    {
+        return std::make_unique<DCRTPoly>(lhs.GetPoly() - rhs.GetPoly());
+    }
+
+    std::unique_ptr<DCRTPoly> DCRTPolyScalarMul(const DCRTPoly &poly, uint64_t scalar)
+    {
+        return std::make_unique<DCRTPoly>(poly.GetPoly() * lbcrypto::BigInteger(scalar));
+    }
+
+    std::unique_ptr<DCRTPoly> DCRTPolyScalarMulLimbs(const DCRTPoly &poly, rust::Slice<const uint64_t> scalarLimbs)
+    {
+        return std::make_unique<DCRTPoly>(poly.GetPoly() * BigIntegerFromLimbsLE(scalarLimbs));
+    }
+
+    void DCRTPolyMulAdd(DCRTPoly &acc, const DCRTPoly &a, const DCRTPoly &b)
+    {
+        lbcrypto::DCRTPoly &accPoly = acc.GetPoly();
+        const lbcrypto::DCRTPoly &aPoly = a.GetPoly();
+        const lbcrypto::DCRTPoly &bPoly = b.GetPoly();
+        CheckSameTowers(accPoly, aPoly);
+        CheckSameTowers(accPoly, bPoly);
+        if (accPoly.GetFormat() != Format::EVALUATION || aPoly.GetFormat() != Format::EVALUATION ||
+            bPoly.GetFormat() != Format::EVALUATION)
+        {
+            throw std::runtime_error("DCRTPolyMulAdd requires EVALUATION format operands");
+        }
+
+        const size_t towers = accPoly.GetNumOfElements();
+        const size_t ringDim = accPoly.GetRingDimension();
+        auto &accTowers = accPoly.GetAllElements();
+        for (size_t t = 0; t < towers; ++t)
+        {
+            const lbcrypto::NativeInteger &q = accTowers[t].GetModulus();
+            const lbcrypto::NativeInteger mu = q.ComputeMu();
+            uint64_t *dst = MutableTowerData(accTowers[t]);
+            const uint64_t *lhs = TowerData(aPoly.GetElementAtIndex(t));
+            const uint64_t *rhs = TowerData(bPoly.GetElementAtIndex(t));
+
+#pragma omp parallel for if (ringDim > 1024)
+            for (long iL = 0; iL < static_cast<long>(ringDim); ++iL)
+            {
+                const size_t i = static_cast<size_t>(iL);
+                lbcrypto::NativeInteger value(dst[i]);
+                value.ModAddFastEq(lbcrypto::NativeInteger(lhs[i]).ModMulFast(lbcrypto::NativeInteger(rhs[i]), q, mu), q);
+                dst[i] = value.ConvertToInt<uint64_t>();
+            }
+        }
+    }
+
     // Generator functions
     std::unique_ptr<DCRTPoly> DCRTPolyGenFromConst(
         usint n,
@@ -157,18 +1005,14 @@ namespace openfhe
         rust::Slice<const uint64_t> values_limbs,
         size_t limbs_per_int)
     {
+        // Create params
+        const std::shared_ptr<CRTBasis> basis = GetCRTBasis(n, size, kRes);
+        const auto &params = basis->GetParams();
+
         if (limbs_per_int == 0)
         {
             // Treat as "all coefficients are zero", regardless of input buffer.
-            auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
-            lbcrypto::BigVector bigVec(params->GetRingDimension(), params->GetModulus());
-
-            lbcrypto::PolyImpl<lbcrypto::BigVector> polyLarge(params, Format::COEFFICIENT);
-            polyLarge.SetValues(bigVec, Format::COEFFICIENT);
-
-            lbcrypto::DCRTPoly dcrtPoly(polyLarge, params);
-            dcrtPoly.SetFormat(Format::EVALUATION);
-            return std::make_unique<DCRTPoly>(std::move(dcrtPoly));
+            return std::make_unique<DCRTPoly>(lbcrypto::DCRTPoly(params, Format::EVALUATION, true));
         }
 
         if (values_limbs.size() % limbs_per_int != 0)
@@ -176,26 +1020,10 @@ namespace openfhe
             throw std::runtime_error("values_limbs length must be a multiple of limbs_per_int");
         }
 
-        // Create params
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
-
-        // Create a BigVector
-        lbcrypto::BigVector bigVec(params->GetRingDimension(), params->GetModulus());
+        // Reduce the limbs straight into every tower
         const size_t count = values_limbs.size() / limbs_per_int;
-        const size_t ringDim = params->GetRingDimension();
-        const size_t limit = (count < ringDim) ? count : ringDim;
-        for (size_t i = 0; i < limit; ++i)
-        {
-            const uint64_t *limbs = values_limbs.data() + (i * limbs_per_int);
-            bigVec[i] = BigIntegerFromFixedLimbsLE(limbs, limbs_per_int);
-        }
-
-        // Create a Poly that supports BigInteger coefficients
-        lbcrypto::PolyImpl<lbcrypto::BigVector> polyLarge(params, Format::COEFFICIENT);
-        polyLarge.SetValues(bigVec, Format::COEFFICIENT);
-
-        // Convert polyLarge to a DCRTPoly
-        lbcrypto::DCRTPoly dcrtPoly(polyLarge, params);
+        lbcrypto::DCRTPoly dcrtPoly = DCRTPolyFromFixedLimbsLE(
+            *basis, Format::COEFFICIENT, values_limbs.data(), count, limbs_per_int);
 
         // switch dcrtPoly to EVALUATION format
         dcrtPoly.SetFormat(Format::EVALUATION);
@@ -210,17 +1038,14 @@ namespace openfhe
         rust::Slice<const uint64_t> values_limbs,
         size_t limbs_per_int)
     {
+        // Create params
+        const std::shared_ptr<CRTBasis> basis = GetCRTBasis(n, size, kRes);
+        const auto &params = basis->GetParams();
+
         if (limbs_per_int == 0)
         {
             // Treat as "all evaluation slots are zero", regardless of input buffer.
-            auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
-            lbcrypto::BigVector bigVec(params->GetRingDimension(), params->GetModulus());
-
-            lbcrypto::PolyImpl<lbcrypto::BigVector> polyLarge(params, Format::EVALUATION);
-            polyLarge.SetValues(bigVec, Format::EVALUATION);
-
-            lbcrypto::DCRTPoly dcrtPoly(polyLarge, params);
-            return std::make_unique<DCRTPoly>(std::move(dcrtPoly));
+            return std::make_unique<DCRTPoly>(lbcrypto::DCRTPoly(params, Format::EVALUATION, true));
         }
 
         if (values_limbs.size() % limbs_per_int != 0)
@@ -228,33 +1053,115 @@ namespace openfhe
             throw std::runtime_error("values_limbs length must be a multiple of limbs_per_int");
         }
 
-        // Create params
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
-
-        // Create a BigVector for evaluation slots
-        lbcrypto::BigVector bigVec(params->GetRingDimension(), params->GetModulus());
+        // Reduce the limbs straight into every tower, keeping them as EVALUATION slots
         const size_t count = values_limbs.size() / limbs_per_int;
+        lbcrypto::DCRTPoly dcrtPoly = DCRTPolyFromFixedLimbsLE(
+            *basis, Format::EVALUATION, values_limbs.data(), count, limbs_per_int);
+
+        return std::make_unique<DCRTPoly>(std::move(dcrtPoly));
+    }
+
+    // Builds the towers from residues already in RNS form, laid out tower-major
+    // (size slices of n values each). Values that are not reduced are taken modulo q_j.
+    lbcrypto::DCRTPoly DCRTPolyFromRnsResidues(
+        const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params,
+        const Format format,
+        rust::Slice<const uint64_t> residues)
+    {
         const size_t ringDim = params->GetRingDimension();
-        const size_t limit = (count < ringDim) ? count : ringDim;
-        for (size_t i = 0; i < limit; ++i)
+        const auto &towerParams = params->GetParams();
+        if (residues.size() != towerParams.size() * ringDim)
         {
-            const uint64_t *limbs = values_limbs.data() + (i * limbs_per_int);
-            bigVec[i] = BigIntegerFromFixedLimbsLE(limbs, limbs_per_int);
+            throw std::runtime_error("residues length must equal size * n");
         }
 
-        // Build a Poly with values interpreted in EVALUATION domain
-        lbcrypto::PolyImpl<lbcrypto::BigVector> polyLarge(params, Format::EVALUATION);
-        polyLarge.SetValues(bigVec, Format::EVALUATION);
+        lbcrypto::DCRTPoly result(params, format);
+        for (size_t t = 0; t < towerParams.size(); ++t)
+        {
+            const lbcrypto::NativeInteger &q = towerParams[t]->GetModulus();
+            const uint64_t modulus = q.ConvertToInt<uint64_t>();
+            const uint64_t *src = residues.data() + (t * ringDim);
+
+            lbcrypto::NativeVector values(ringDim, q);
+            for (size_t i = 0; i < ringDim; ++i)
+            {
+                const uint64_t v = src[i];
+                values[i] = lbcrypto::NativeInteger(v < modulus ? v : v % modulus);
+            }
 
-        // Convert to a DCRTPoly
-        lbcrypto::DCRTPoly dcrtPoly(polyLarge, params);
+            lbcrypto::DCRTPoly::PolyType tower(towerParams[t], format);
+            tower.SetValues(std::move(values), format);
+            result.SetElementAtIndex(t, std::move(tower));
+        }
+        return result;
+    }
 
+    lbcrypto::DCRTPoly DCRTPolyFromSmallIntegers(
+        const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params,
+        const Format format,
+        rust::Slice<const int64_t> coeffs)
+    {
+        const size_t ringDim = params->GetRingDimension();
+        const auto &towerParams = params->GetParams();
+        if (coeffs.size() != ringDim)
+        {
+            throw std::runtime_error("coefficient count must equal n");
+        }
+
+        lbcrypto::DCRTPoly result(params, format);
+#pragma omp parallel for if (towerParams.size() > 1)
+        for (long tL = 0; tL < static_cast<long>(towerParams.size()); tL++)
+        {
+            const size_t t = static_cast<size_t>(tL);
+            const lbcrypto::NativeInteger &q = towerParams[t]->GetModulus();
+            const uint64_t qt = q.ConvertToInt<uint64_t>();
+
+            lbcrypto::NativeVector values(ringDim, q);
+            for (size_t i = 0; i < ringDim; i++)
+            {
+                const int64_t v = coeffs[i];
+                // |v| as unsigned, so INT64_MIN does not overflow
+                uint64_t magnitude = v >= 0 ? static_cast<uint64_t>(v) : 0 - static_cast<uint64_t>(v);
+                if (magnitude >= qt)
+                {
+                    magnitude %= qt;
+                }
+                values[i] = lbcrypto::NativeInteger(v >= 0 || magnitude == 0 ? magnitude : qt - magnitude);
+            }
+
+            lbcrypto::DCRTPoly::PolyType tower(towerParams[t], Format::COEFFICIENT);
+            tower.SetValues(std::move(values), Format::COEFFICIENT);
+            tower.SetFormat(format);
+            result.SetElementAtIndex(t, std::move(tower));
+        }
+        return result;
+    }
+
+    std::unique_ptr<DCRTPoly> DCRTPolyGenFromRnsVec(
+        usint n,
+        size_t size,
+        size_t kRes,
+        rust::Slice<const uint64_t> residues)
+    {
+        auto params = GetDCRTPolyParams(n, size, kRes);
+        lbcrypto::DCRTPoly dcrtPoly = DCRTPolyFromRnsResidues(params, Format::COEFFICIENT, residues);
+        dcrtPoly.SetFormat(Format::EVALUATION);
         return std::make_unique<DCRTPoly>(std::move(dcrtPoly));
     }
 
+    std::unique_ptr<DCRTPoly> DCRTPolyGenFromRnsEvalVec(
+        usint n,
+        size_t size,
+        size_t kRes,
+        rust::Slice<const uint64_t> residues)
+    {
+        auto params = GetDCRTPolyParams(n, size, kRes);
+        return std::make_unique<DCRTPoly>(DCRTPolyFromRnsResidues(params, Format::EVALUATION, residues));
+    }
+
     std::unique_ptr<DCRTPoly> DCRTPolyGenFromBug(usint n, size_t size, size_t kRes)
     {
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+        auto params = GetDCRTPolyParams(n, size, kRes);
         typename lbcrypto::DCRTPoly::BugType bug;
         auto poly = lbcrypto::DCRTPoly(bug, params, Format::EVALUATION);
         return std::make_unique<DCRTPoly>(std::move(poly));
@@ -262,7 +1169,7 @@ namespace openfhe
 
     std::unique_ptr<DCRTPoly> DCRTPolyGenFromDug(usint n, size_t size, size_t kRes)
     {
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+        auto params = GetDCRTPolyParams(n, size, kRes);
         typename lbcrypto::DCRTPoly::DugType dug;
         auto poly = lbcrypto::DCRTPoly(dug, params, Format::EVALUATION);
         return std::make_unique<DCRTPoly>(std::move(poly));
@@ -270,7 +1177,7 @@ namespace openfhe
 
     std::unique_ptr<DCRTPoly> DCRTPolyGenFromDgg(usint n, size_t size, size_t kRes, double sigma)
     {
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+        auto params = GetDCRTPolyParams(n, size, kRes);
         typename lbcrypto::DCRTPoly::DggType dgg(sigma);
         auto poly = lbcrypto::DCRTPoly(dgg, params, Format::EVALUATION);
         return std::make_unique<DCRTPoly>(std::move(poly));
@@ -278,25 +1185,230 @@ namespace openfhe
 
     std::unique_ptr<DCRTPoly> DCRTPolyGenFromTug(usint n, size_t size, size_t kRes)
     {
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+        auto params = GetDCRTPolyParams(n, size, kRes);
         typename lbcrypto::DCRTPoly::TugType tug;
         auto poly = lbcrypto::DCRTPoly(tug, params, Format::EVALUATION);
         return std::make_unique<DCRTPoly>(std::move(poly));
     }
 
+    std::unique_ptr<DCRTPoly> DCRTPolyGenFromDugSeeded(
+        usint n,
+        size_t size,
+        size_t kRes,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream)
+    {
+        auto params = GetDCRTPolyParams(n, size, kRes);
+        ChaChaPrng prng(seed, stream);
+        lbcrypto::DCRTPoly poly(params, Format::EVALUATION, true);
+        FillUniform(poly, prng);
+        return std::make_unique<DCRTPoly>(std::move(poly));
+    }
+
     DCRTPolyParams::DCRTPolyParams(const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params) noexcept
         : m_params(params)
     {
     }
     const std::shared_ptr<lbcrypto::DCRTPoly::Params> &DCRTPolyParams::GetRef() const noexcept
     {
-        return m_params;
+        return m_params;
+    }
+
+    CRTBasis::CRTBasis(const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params)
+        : m_params(params)
+    {
+        const lbcrypto::BigInteger &modulus = params->GetModulus();
+        const auto &towerParams = params->GetParams();
+        const size_t towers = towerParams.size();
+        const size_t modulusLimbs = (modulus.GetMSB() + 63) / 64;
+
+        m_modulusLimbs.resize(modulusLimbs);
+        m_qHat.resize(towers * modulusLimbs);
+        m_moduli.reserve(towers);
+        m_qHatInv.reserve(towers);
+        m_qHatInvNative.reserve(towers);
+        m_qHatInvPrecon.reserve(towers);
+        m_qInv.reserve(towers);
+        BigIntegerToLimbsLE(modulus, modulusLimbs, m_modulusLimbs.data());
+
+        for (size_t t = 0; t < towers; ++t)
+        {
+            const lbcrypto::NativeInteger &q = towerParams[t]->GetModulus();
+            const lbcrypto::BigInteger bigQ(q.ConvertToInt<uint64_t>());
+            const lbcrypto::BigInteger qHat = modulus / bigQ;
+            BigIntegerToLimbsLE(qHat, modulusLimbs, &m_qHat[t * modulusLimbs]);
+
+            const lbcrypto::NativeInteger qHatModQ(qHat.Mod(bigQ).ConvertToInt<uint64_t>());
+            m_moduli.push_back(q.ConvertToInt<uint64_t>());
+            m_qHatInvNative.push_back(qHatModQ.ModInverse(q));
+            m_qHatInv.push_back(m_qHatInvNative.back().ConvertToInt<uint64_t>());
+            m_qHatInvPrecon.push_back(m_qHatInvNative.back().PrepModMulConst(q));
+            m_qInv.push_back(1.0 / q.ConvertToDouble());
+        }
+    }
+
+    const std::shared_ptr<lbcrypto::DCRTPoly::Params> &CRTBasis::GetParams() const noexcept
+    {
+        return m_params;
+    }
+
+    usint CRTBasis::GetRingDimension() const noexcept
+    {
+        return m_params->GetRingDimension();
+    }
+
+    rust::Slice<const uint64_t> CRTBasis::GetModuli() const noexcept
+    {
+        return rust::Slice<const uint64_t>(m_moduli.data(), m_moduli.size());
+    }
+
+    rust::Slice<const uint64_t> CRTBasis::GetModulusLimbs() const noexcept
+    {
+        return rust::Slice<const uint64_t>(m_modulusLimbs.data(), m_modulusLimbs.size());
+    }
+
+    rust::Slice<const uint64_t> CRTBasis::GetQHat() const noexcept
+    {
+        return rust::Slice<const uint64_t>(m_qHat.data(), m_qHat.size());
+    }
+
+    rust::Slice<const uint64_t> CRTBasis::GetQHatInv() const noexcept
+    {
+        return rust::Slice<const uint64_t>(m_qHatInv.data(), m_qHatInv.size());
+    }
+
+    const std::vector<lbcrypto::NativeInteger> &CRTBasis::GetQHatInvNative() const noexcept
+    {
+        return m_qHatInvNative;
+    }
+
+    const std::vector<lbcrypto::NativeInteger> &CRTBasis::GetQHatInvPrecon() const noexcept
+    {
+        return m_qHatInvPrecon;
+    }
+
+    const std::vector<double> &CRTBasis::GetQInv() const noexcept
+    {
+        return m_qInv;
+    }
+
+    // Generator functions
+    std::unique_ptr<DCRTPolyParams> DCRTPolyGenNullParams()
+    {
+        return std::make_unique<DCRTPolyParams>();
+    }
+
+    std::unique_ptr<DCRTPolyParams> DCRTPolyGenParams(usint n, size_t size, size_t kRes)
+    {
+        return std::make_unique<DCRTPolyParams>(GetDCRTPolyParams(n, size, kRes));
+    }
+
+    void DCRTPolyClearParamsCache()
+    {
+        std::lock_guard<std::mutex> lock(ParamsCacheMutex());
+        ParamsCache().clear();
+        OwnedBasisIndex().clear();
+        g_paramsCacheGeneration.fetch_add(1, std::memory_order_release);
+    }
+
+    std::shared_ptr<CRTBasis> DCRTPolyGenCRTBasis(usint n, size_t size, size_t kRes)
+    {
+        return GetCRTBasis(n, size, kRes);
+    }
+
+    std::shared_ptr<CRTBasis> GetCRTBasis(
+        usint n,
+        size_t size,
+        size_t kRes)
+    {
+        const ParamsKey key(n, size, kRes);
+
+        std::promise<std::shared_ptr<CRTBasis>> promise;
+        CachedBasis future;
+        uint64_t generation = 0;
+        {
+            std::lock_guard<std::mutex> lock(ParamsCacheMutex());
+            auto &cache = ParamsCache();
+            auto it = cache.find(key);
+            if (it != cache.end())
+            {
+                future = it->second;
+            }
+            else
+            {
+                cache.emplace(key, promise.get_future().share());
+                generation = g_paramsCacheGeneration.load(std::memory_order_relaxed);
+            }
+        }
+        if (future.valid())
+        {
+            return future.get();
+        }
+
+        // prime generation and root-of-unity search run without holding the mutex
+        try
+        {
+            auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+            auto basis = std::make_shared<CRTBasis>(params);
+            promise.set_value(basis);
+            {
+                std::lock_guard<std::mutex> lock(ParamsCacheMutex());
+                if (g_paramsCacheGeneration.load(std::memory_order_relaxed) == generation)
+                {
+                    OwnedBasisIndex().emplace(params.get(), basis);
+                }
+            }
+            return basis;
+        }
+        catch (...)
+        {
+            // waiters see the error; the key is dropped so a later call can retry, unless a clear
+            // already dropped it and the key now belongs to a newer caller's entry
+            promise.set_exception(std::current_exception());
+            std::lock_guard<std::mutex> lock(ParamsCacheMutex());
+            if (g_paramsCacheGeneration.load(std::memory_order_relaxed) == generation)
+            {
+                ParamsCache().erase(key);
+            }
+            throw;
+        }
+    }
+
+    std::shared_ptr<CRTBasis> GetCRTBasis(const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params)
+    {
+        // the last cache-owned basis this thread looked up, served without taking the mutex
+        thread_local std::shared_ptr<CRTBasis> memo;
+        thread_local uint64_t memoGeneration = 0;
+
+        const uint64_t generation = g_paramsCacheGeneration.load(std::memory_order_acquire);
+        if (memo && memoGeneration == generation && memo->GetParams() == params)
+        {
+            return memo;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(ParamsCacheMutex());
+            const auto &index = OwnedBasisIndex();
+            auto it = index.find(params.get());
+            if (it != index.end())
+            {
+                memo = it->second;
+                memoGeneration = generation;
+                return memo;
+            }
+        }
+
+        // params the cache does not own are never retained: their basis is rebuilt per call
+        memo.reset();
+        return std::make_shared<CRTBasis>(params);
     }
 
-    // Generator functions
-    std::unique_ptr<DCRTPolyParams> DCRTPolyGenNullParams()
+    std::shared_ptr<lbcrypto::DCRTPoly::Params> GetDCRTPolyParams(
+        usint n,
+        size_t size,
+        size_t kRes)
     {
-        return std::make_unique<DCRTPolyParams>();
+        return GetCRTBasis(n, size, kRes)->GetParams();
     }
 
     // Matrix functions
@@ -307,22 +1419,72 @@ namespace openfhe
         size_t nrow,
         size_t ncol)
     {
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+        auto params = GetDCRTPolyParams(n, size, kRes);
         auto zero_alloc = lbcrypto::DCRTPoly::Allocator(params, Format::EVALUATION);
         Matrix matrix(zero_alloc, nrow, ncol);
         return std::make_unique<Matrix>(std::move(matrix));
     }
 
+    Matrix UniformMatrixFromSeed(
+        const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params,
+        size_t nrow,
+        size_t ncol,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream)
+    {
+        // checked here since nothing may throw out of the parallel region
+        if (seed.size() != PRNG_SEED_BYTES)
+        {
+            throw std::runtime_error("PRNG seed must be 32 bytes");
+        }
+
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(params, Format::EVALUATION);
+        Matrix matrix(zero_alloc, nrow, ncol);
+        const size_t entries = nrow * ncol;
+#pragma omp parallel for if (entries > 1)
+        for (long eL = 0; eL < static_cast<long>(entries); ++eL)
+        {
+            const size_t e = static_cast<size_t>(eL);
+            ChaChaPrng prng(seed, stream);
+            prng.Seek(static_cast<uint64_t>(e) << 32);
+            FillUniform(matrix(e / ncol, e % ncol), prng);
+        }
+        return matrix;
+    }
+
+    std::unique_ptr<Matrix> MatrixGenFromDugSeeded(
+        usint n,
+        size_t size,
+        size_t kRes,
+        size_t nrow,
+        size_t ncol,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream)
+    {
+        return std::make_unique<Matrix>(
+            UniformMatrixFromSeed(GetDCRTPolyParams(n, size, kRes), nrow, ncol, seed, stream));
+    }
+
     std::unique_ptr<Matrix> GetMatrixFromFs(
         usint n,
         size_t size,
         size_t kRes,
         const rust::String &path)
     {
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+        auto params = GetDCRTPolyParams(n, size, kRes);
 
         std::string dataPath = std::string(path);
 
+        // Fixed-layout files (see MatrixFile.h) skip cereal entirely
+        if (IsMatrixFile(dataPath))
+        {
+            return MappedMatrix(dataPath, params).ToMatrix();
+        }
+        if (IsSeededMatrixFile(dataPath))
+        {
+            return std::make_unique<Matrix>(ReadSeededMatrixFile(dataPath, params));
+        }
+
         lbcrypto::Matrix<lbcrypto::DCRTPoly> deserializedMatrix;
         bool deserializeSuccessResult = lbcrypto::Serial::DeserializeFromFile(dataPath, deserializedMatrix, lbcrypto::SerType::BINARY);
         if (!deserializeSuccessResult)
@@ -336,6 +1498,49 @@ namespace openfhe
         return std::make_unique<Matrix>(std::move(deserializedMatrix));
     }
 
+    rust::Vec<uint8_t> DCRTPolySerializeToBytes(const DCRTPoly &poly, const SerialMode serialMode)
+    {
+        return SerializeObjectToBytes(poly.GetPoly(), serialMode);
+    }
+
+    std::unique_ptr<DCRTPoly> DCRTPolyDeserializeFromBytes(
+        rust::Slice<const uint8_t> data,
+        const SerialMode serialMode)
+    {
+        lbcrypto::DCRTPoly poly;
+        if (!DeserializeObjectFromBytes(data, poly, serialMode))
+        {
+            return nullptr;
+        }
+        return std::make_unique<DCRTPoly>(std::move(poly));
+    }
+
+    rust::Vec<uint8_t> MatrixSerializeToBytes(const Matrix &matrix, const SerialMode serialMode)
+    {
+        return SerializeObjectToBytes(matrix, serialMode);
+    }
+
+    std::unique_ptr<Matrix> MatrixDeserializeFromBytes(
+        usint n,
+        size_t size,
+        size_t kRes,
+        rust::Slice<const uint8_t> data,
+        const SerialMode serialMode)
+    {
+        auto params = GetDCRTPolyParams(n, size, kRes);
+
+        lbcrypto::Matrix<lbcrypto::DCRTPoly> deserializedMatrix;
+        if (!DeserializeObjectFromBytes(data, deserializedMatrix, serialMode))
+        {
+            return nullptr;
+        }
+
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(params, Format::EVALUATION);
+        deserializedMatrix.SetAllocator(zero_alloc);
+
+        return std::make_unique<Matrix>(std::move(deserializedMatrix));
+    }
+
     void SetMatrixElement(
         Matrix &matrix,
         size_t row,
@@ -354,6 +1559,55 @@ namespace openfhe
         return std::make_unique<DCRTPoly>(std::move(copy));
     }
 
+    std::unique_ptr<DCRTPoly> GetMatrixElementRef(
+        const Matrix &matrix,
+        size_t row,
+        size_t col)
+    {
+        if (row >= matrix.GetRows() || col >= matrix.GetCols())
+        {
+            throw std::out_of_range("matrix index out of range");
+        }
+        return DCRTPoly::Borrow(matrix(row, col));
+    }
+
+    std::unique_ptr<DCRTPoly> GetMatrixElementMut(
+        Matrix &matrix,
+        size_t row,
+        size_t col)
+    {
+        if (row >= matrix.GetRows() || col >= matrix.GetCols())
+        {
+            throw std::out_of_range("matrix index out of range");
+        }
+        return DCRTPoly::Borrow(matrix(row, col));
+    }
+
+    void SetMatrixElementOwned(
+        Matrix &matrix,
+        size_t row,
+        size_t col,
+        std::unique_ptr<DCRTPoly> element)
+    {
+        if (row >= matrix.GetRows() || col >= matrix.GetCols())
+        {
+            throw std::out_of_range("matrix index out of range");
+        }
+        if (!element)
+        {
+            throw std::runtime_error("element must not be null");
+        }
+        if (element->IsBorrowed())
+        {
+            // Never move out of storage the wrapper does not own.
+            matrix(row, col) = element->GetPoly();
+        }
+        else
+        {
+            matrix(row, col) = std::move(element->GetPoly());
+        }
+    }
+
     size_t GetMatrixRows(const Matrix &matrix)
     {
         return matrix.GetRows();
@@ -368,16 +1622,22 @@ namespace openfhe
         const Matrix &matrix,
         size_t row)
     {
-        lbcrypto::Matrix<lbcrypto::DCRTPoly> extracted = matrix.ExtractRow(row);
-        return std::make_unique<Matrix>(std::move(extracted));
+        if (row >= matrix.GetRows())
+        {
+            throw std::out_of_range("matrix row out of range");
+        }
+        return MatrixView(matrix, row, row + 1, 0, matrix.GetCols()).Materialize();
     }
 
     std::unique_ptr<Matrix> ExtractMatrixCol(
         const Matrix &matrix,
         size_t col)
     {
-        lbcrypto::Matrix<lbcrypto::DCRTPoly> extracted = matrix.ExtractCol(col);
-        return std::make_unique<Matrix>(std::move(extracted));
+        if (col >= matrix.GetCols())
+        {
+            throw std::out_of_range("matrix column out of range");
+        }
+        return MatrixView(matrix, 0, matrix.GetRows(), col, col + 1).Materialize();
     }
 
     std::unique_ptr<Matrix> ExtractMatrixRows(
@@ -385,8 +1645,12 @@ namespace openfhe
         size_t startRow,
         size_t endRow)
     {
-        lbcrypto::Matrix<lbcrypto::DCRTPoly> extracted = matrix.ExtractRows(startRow, endRow);
-        return std::make_unique<Matrix>(std::move(extracted));
+        // Inclusive, as lbcrypto::Matrix::ExtractRows
+        if (startRow > endRow || endRow >= matrix.GetRows())
+        {
+            throw std::out_of_range("matrix row range out of range");
+        }
+        return MatrixView(matrix, startRow, endRow + 1, 0, matrix.GetCols()).Materialize();
     }
 
     std::unique_ptr<Matrix> ExtractMatrixCols(
@@ -394,18 +1658,388 @@ namespace openfhe
         size_t startCol,
         size_t endCol)
     {
-        lbcrypto::Matrix<lbcrypto::DCRTPoly> result = matrix.ExtractCol(startCol);
-        for (size_t i = startCol + 1; i < endCol; i++)
+        // End-exclusive, except that an empty range still yields column `startCol`
+        if (startCol == endCol)
+        {
+            return ExtractMatrixCol(matrix, startCol);
+        }
+        const MatrixView view(matrix, 0, matrix.GetRows(), startCol, endCol);
+        return view.Materialize();
+    }
+
+    std::unique_ptr<Matrix> MatrixMul(const Matrix &a, const Matrix &b)
+    {
+        CheckMatrixMulShapes(a, b);
+
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(a(0, 0).GetParams(), Format::EVALUATION);
+        auto result = std::make_unique<Matrix>(zero_alloc, a.GetRows(), b.GetCols());
+        MatrixMulInto(a, b, *result, false);
+        return result;
+    }
+
+    void MatrixMulAccumulate(Matrix &c, const Matrix &a, const Matrix &b)
+    {
+        CheckMatrixMulShapes(a, b);
+        if (c.GetRows() != a.GetRows() || c.GetCols() != b.GetCols())
+        {
+            throw std::runtime_error("accumulator dimensions do not match the product");
+        }
+        CheckEvaluationMatrix(c);
+        CheckUniformTowers(c, a(0, 0));
+
+        MatrixMulInto(a, b, c, true);
+    }
+
+    std::unique_ptr<Matrix> MatrixAdd(const Matrix &a, const Matrix &b)
+    {
+        return MatrixElementwise(a, b, [](lbcrypto::DCRTPoly &lhs, const lbcrypto::DCRTPoly &rhs)
+                                 { lhs += rhs; });
+    }
+
+    std::unique_ptr<Matrix> MatrixSub(const Matrix &a, const Matrix &b)
+    {
+        return MatrixElementwise(a, b, [](lbcrypto::DCRTPoly &lhs, const lbcrypto::DCRTPoly &rhs)
+                                 { lhs -= rhs; });
+    }
+
+    std::unique_ptr<Matrix> MatrixScalarMul(const Matrix &matrix, const DCRTPoly &scalar)
+    {
+        CheckEvaluationMatrix(matrix);
+        const lbcrypto::DCRTPoly &scalarPoly = scalar.GetPoly();
+        if (scalarPoly.GetFormat() != Format::EVALUATION)
+        {
+            throw std::runtime_error("scalar must be in EVALUATION format");
+        }
+        CheckUniformTowers(matrix, scalarPoly);
+
+        auto result = std::make_unique<Matrix>(matrix);
+        const size_t cols = matrix.GetCols();
+        const size_t entries = matrix.GetRows() * cols;
+#pragma omp parallel for if (entries > 1)
+        for (long eL = 0; eL < static_cast<long>(entries); ++eL)
+        {
+            const size_t e = static_cast<size_t>(eL);
+            (*result)(e / cols, e % cols) *= scalarPoly;
+        }
+        return result;
+    }
+
+    MatrixView::MatrixView(
+        const Matrix &matrix,
+        size_t startRow,
+        size_t endRow,
+        size_t startCol,
+        size_t endCol)
+        : m_matrix(&matrix), m_rowOffset(startRow), m_colOffset(startCol),
+          m_rows(endRow - startRow), m_cols(endCol - startCol)
+    {
+        if (startRow > endRow || endRow > matrix.GetRows() || startCol > endCol || endCol > matrix.GetCols())
+        {
+            throw std::out_of_range("matrix view range out of bounds");
+        }
+    }
+
+    size_t MatrixView::GetRows() const noexcept
+    {
+        return m_rows;
+    }
+
+    size_t MatrixView::GetCols() const noexcept
+    {
+        return m_cols;
+    }
+
+    const lbcrypto::DCRTPoly &MatrixView::operator()(size_t row, size_t col) const
+    {
+        return (*m_matrix)(m_rowOffset + row, m_colOffset + col);
+    }
+
+    std::unique_ptr<DCRTPoly> MatrixView::GetElementRef(size_t row, size_t col) const
+    {
+        if (row >= m_rows || col >= m_cols)
+        {
+            throw std::out_of_range("matrix view index out of range");
+        }
+        return DCRTPoly::Borrow((*this)(row, col));
+    }
+
+    std::unique_ptr<MatrixView> MatrixView::SubView(
+        size_t startRow,
+        size_t endRow,
+        size_t startCol,
+        size_t endCol) const
+    {
+        if (startRow > endRow || endRow > m_rows || startCol > endCol || endCol > m_cols)
+        {
+            throw std::out_of_range("matrix view range out of bounds");
+        }
+        return std::make_unique<MatrixView>(
+            *m_matrix,
+            m_rowOffset + startRow,
+            m_rowOffset + endRow,
+            m_colOffset + startCol,
+            m_colOffset + endCol);
+    }
+
+    std::unique_ptr<Matrix> MatrixView::Materialize() const
+    {
+        // One allocation for the whole result, then a parallel copy of each entry
+        auto result = std::make_unique<Matrix>(m_matrix->GetAllocator(), m_rows, m_cols);
+        const size_t entries = m_rows * m_cols;
+#pragma omp parallel for if (entries > 1)
+        for (long eL = 0; eL < static_cast<long>(entries); ++eL)
+        {
+            const size_t e = static_cast<size_t>(eL);
+            (*result)(e / m_cols, e % m_cols) = (*this)(e / m_cols, e % m_cols);
+        }
+        return result;
+    }
+
+    std::unique_ptr<MatrixView> MatrixViewGen(
+        const Matrix &matrix,
+        size_t startRow,
+        size_t endRow,
+        size_t startCol,
+        size_t endCol)
+    {
+        return std::make_unique<MatrixView>(matrix, startRow, endRow, startCol, endCol);
+    }
+
+    std::unique_ptr<Matrix> MatrixViewMul(const MatrixView &a, const MatrixView &b)
+    {
+        CheckMatrixMulShapes(a, b);
+
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(a(0, 0).GetParams(), Format::EVALUATION);
+        auto result = std::make_unique<Matrix>(zero_alloc, a.GetRows(), b.GetCols());
+        MatrixMulInto(a, b, *result, false);
+        return result;
+    }
+
+    std::unique_ptr<Matrix> MatrixDecompose(const Matrix &matrix, uint32_t baseBits, Format format)
+    {
+        const size_t rows = matrix.GetRows();
+        const size_t cols = matrix.GetCols();
+        if (rows == 0 || cols == 0)
+        {
+            throw std::runtime_error("matrix dimensions must be non-zero");
+        }
+
+        const auto &params = matrix(0, 0).GetParams();
+        const std::vector<size_t> offsets = TowerDigitOffsets(*params, baseBits);
+        const size_t k = offsets.back();
+        const size_t towers = offsets.size() - 1;
+        const size_t entries = rows * cols;
+
+        std::vector<lbcrypto::DCRTPoly> scratch;
+        const std::vector<const lbcrypto::DCRTPoly *> coeffs = CoefficientEntries(matrix, scratch);
+
+        auto result = std::make_unique<Matrix>(lbcrypto::DCRTPoly::Allocator(params, format), k * rows, cols);
+        const size_t items = entries * towers;
+#pragma omp parallel for schedule(dynamic) if (items > 1)
+        for (long itemL = 0; itemL < static_cast<long>(items); ++itemL)
+        {
+            const size_t item = static_cast<size_t>(itemL);
+            const size_t e = item / towers;
+            const size_t t = item % towers;
+            const size_t i = e / cols;
+            const size_t j = e % cols;
+            DecomposeTowerInto(*coeffs[e], t, offsets[t], baseBits, format, [&](size_t digit) -> lbcrypto::DCRTPoly &
+                               { return (*result)((i * k) + digit, j); });
+        }
+        return result;
+    }
+
+    size_t GadgetDigitsPerTower(
+        usint n,
+        size_t size,
+        size_t kRes,
+        int64_t base,
+        bool balanced)
+    {
+        return GadgetTowerDigits(*GetDCRTPolyParams(n, size, kRes), base, balanced);
+    }
+
+    std::unique_ptr<Matrix> MatrixGadgetDecompose(const Matrix &matrix, int64_t base, bool balanced)
+    {
+        const size_t rows = matrix.GetRows();
+        const size_t cols = matrix.GetCols();
+        if (rows == 0 || cols == 0)
+        {
+            throw std::runtime_error("matrix dimensions must be non-zero");
+        }
+        CheckUniformTowers(matrix, matrix(0, 0));
+
+        const auto &params = matrix(0, 0).GetParams();
+        const size_t digits = GadgetTowerDigits(*params, base, balanced);
+        const size_t towers = params->GetParams().size();
+        const size_t k = towers * digits;
+        const size_t entries = rows * cols;
+
+        std::vector<lbcrypto::DCRTPoly> scratch;
+        const std::vector<const lbcrypto::DCRTPoly *> coeffs = CoefficientEntries(matrix, scratch);
+
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(params, Format::EVALUATION);
+        auto result = std::make_unique<Matrix>(zero_alloc, k * rows, cols);
+        const size_t items = entries * towers;
+#pragma omp parallel for schedule(dynamic) if (items > 1)
+        for (long itemL = 0; itemL < static_cast<long>(items); ++itemL)
+        {
+            const size_t item = static_cast<size_t>(itemL);
+            const size_t e = item / towers;
+            const size_t t = item % towers;
+            const size_t i = e / cols;
+            const size_t j = e % cols;
+            GadgetDecomposeTowerInto(
+                *coeffs[e], t, t * digits, digits, base, balanced, Format::EVALUATION,
+                [&](size_t digit) -> lbcrypto::DCRTPoly & { return (*result)((i * k) + digit, j); });
+        }
+        return result;
+    }
+
+    std::unique_ptr<Matrix> GadgetMul(const Matrix &matrix, int64_t base, size_t len)
+    {
+        const size_t rows = matrix.GetRows();
+        const size_t cols = matrix.GetCols();
+        if (rows == 0 || cols == 0)
+        {
+            throw std::runtime_error("matrix dimensions must be non-zero");
+        }
+        CheckEvaluationMatrix(matrix);
+        CheckUniformTowers(matrix, matrix(0, 0));
+
+        const auto &params = matrix(0, 0).GetParams();
+        const GadgetPowers table = ComputeGadgetPowers(*params, base, len);
+        const size_t towers = table.powers.size();
+        const size_t digits = len / towers;
+        const size_t ringDim = params->GetRingDimension();
+
+        // entry (a, i) times g fills columns [i * len, (i + 1) * len) of row a; each item owns
+        // the `digits` outputs whose only non-zero tower is t
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(params, Format::EVALUATION);
+        auto result = std::make_unique<Matrix>(zero_alloc, rows, cols * len);
+        const size_t items = rows * cols * towers;
+#pragma omp parallel for if (items > 1)
+        for (long itemL = 0; itemL < static_cast<long>(items); ++itemL)
+        {
+            const size_t item = static_cast<size_t>(itemL);
+            const size_t e = item / towers;
+            const size_t t = item % towers;
+            const size_t a = e / cols;
+            const size_t i = e % cols;
+            const lbcrypto::NativeInteger &q = params->GetParams()[t]->GetModulus();
+            const uint64_t *src = TowerData(matrix(a, i).GetElementAtIndex(t));
+
+            for (size_t l = 0; l < digits; l++)
+            {
+                const lbcrypto::NativeInteger &power = table.powers[t][l];
+                const lbcrypto::NativeInteger &precon = table.precons[t][l];
+                uint64_t *dst = MutableTowerData((*result)(a, (i * len) + (t * digits) + l).GetAllElements()[t]);
+                for (size_t c = 0; c < ringDim; c++)
+                {
+                    dst[c] = lbcrypto::NativeInteger(src[c]).ModMulFastConst(power, q, precon).ConvertToInt<uint64_t>();
+                }
+            }
+        }
+        return result;
+    }
+
+    std::unique_ptr<Matrix> GadgetMulTranspose(const Matrix &matrix, int64_t base, size_t len)
+    {
+        const size_t rows = matrix.GetRows();
+        const size_t cols = matrix.GetCols();
+        if (rows == 0 || cols == 0)
+        {
+            throw std::runtime_error("matrix dimensions must be non-zero");
+        }
+        CheckEvaluationMatrix(matrix);
+        CheckUniformTowers(matrix, matrix(0, 0));
+
+        const auto &params = matrix(0, 0).GetParams();
+        const GadgetPowers table = ComputeGadgetPowers(*params, base, len);
+        if (rows % len != 0)
+        {
+            throw std::runtime_error("row count must be a multiple of the gadget length");
+        }
+        const size_t towers = table.powers.size();
+        const size_t digits = len / towers;
+        const size_t ringDim = params->GetRingDimension();
+
+        // tower t of (G X)(i, j) is sum_l b^l X(i * len + t * digits + l, j) mod q_t
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(params, Format::EVALUATION);
+        auto result = std::make_unique<Matrix>(zero_alloc, rows / len, cols);
+        const size_t items = (rows / len) * cols * towers;
+#pragma omp parallel for if (items > 1)
+        for (long itemL = 0; itemL < static_cast<long>(items); ++itemL)
         {
-            result.HStack(matrix.ExtractCol(i));
+            const size_t item = static_cast<size_t>(itemL);
+            const size_t e = item / towers;
+            const size_t t = item % towers;
+            const size_t i = e / cols;
+            const size_t j = e % cols;
+            const lbcrypto::NativeInteger &q = params->GetParams()[t]->GetModulus();
+            uint64_t *dst = MutableTowerData((*result)(i, j).GetAllElements()[t]);
+
+            for (size_t l = 0; l < digits; l++)
+            {
+                const lbcrypto::NativeInteger &power = table.powers[t][l];
+                const lbcrypto::NativeInteger &precon = table.precons[t][l];
+                const uint64_t *src = TowerData(matrix((i * len) + (t * digits) + l, j).GetElementAtIndex(t));
+                for (size_t c = 0; c < ringDim; c++)
+                {
+                    lbcrypto::NativeInteger acc(dst[c]);
+                    acc.ModAddFastEq(lbcrypto::NativeInteger(src[c]).ModMulFastConst(power, q, precon), q);
+                    dst[c] = acc.ConvertToInt<uint64_t>();
+                }
+            }
         }
-        return std::make_unique<Matrix>(std::move(result));
+        return result;
     }
 
     void FormatMatrixCoefficient(
         Matrix &matrix)
     {
-        matrix.SetFormat(Format::COEFFICIENT);
+        FormatMatrix(matrix, Format::COEFFICIENT);
+    }
+
+    void FormatMatrix(
+        Matrix &matrix,
+        Format format)
+    {
+        // Flatten (entry, tower) so a few many-tower polys still spread over every core. Each
+        // entry contributes its own tower count.
+        std::vector<lbcrypto::DCRTPoly *> pending;
+        std::vector<std::pair<lbcrypto::DCRTPoly *, size_t>> items;
+        for (size_t i = 0; i < matrix.GetRows(); ++i)
+        {
+            for (size_t j = 0; j < matrix.GetCols(); ++j)
+            {
+                lbcrypto::DCRTPoly &poly = matrix(i, j);
+                if (poly.GetFormat() != format)
+                {
+                    pending.push_back(&poly);
+                    for (size_t t = 0; t < poly.GetNumOfElements(); ++t)
+                    {
+                        items.emplace_back(&poly, t);
+                    }
+                }
+            }
+        }
+        if (pending.empty())
+        {
+            return;
+        }
+
+#pragma omp parallel for schedule(dynamic) if (items.size() > 1)
+        for (long itemL = 0; itemL < static_cast<long>(items.size()); ++itemL)
+        {
+            const std::pair<lbcrypto::DCRTPoly *, size_t> &item = items[static_cast<size_t>(itemL)];
+            item.first->GetAllElements()[item.second].SetFormat(format);
+        }
+
+        for (lbcrypto::DCRTPoly *poly : pending)
+        {
+            poly->OverrideFormat(format);
+        }
     }
 
 } // openfhe
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 #include "openfhe/core/lattice/hal/lat-backend.h"
 #include "rust/cxx.h"
+#include "SerialMode.h"
 #include "openfhe/core/math/matrix.h"
 #include "openfhe/core/utils/serial.h"
 
@@ -13,23 +16,66 @@ namespace openfhe
 
     class DCRTPoly final
     {
-        lbcrypto::DCRTPoly m_poly;
+        lbcrypto::DCRTPoly m_owned;
+        // Either m_owned or a poly owned elsewhere; see Borrowed.
+        lbcrypto::DCRTPoly &m_poly;
 
     public:
+        // Tag for the non-owning constructors: the wrapper refers to a poly owned elsewhere
+        // (a Matrix entry, a trapdoor) without copying it, and the owner must outlive it.
+        // A wrapper built from a const poly must only be used read-only.
+        struct Borrowed final
+        {
+        };
+
         DCRTPoly(lbcrypto::DCRTPoly &&poly) noexcept;
+        DCRTPoly(Borrowed, lbcrypto::DCRTPoly &poly) noexcept;
+        DCRTPoly(Borrowed, const lbcrypto::DCRTPoly &poly) noexcept;
         DCRTPoly(const DCRTPoly &) = delete;
         DCRTPoly(DCRTPoly &&) = delete;
         DCRTPoly &operator=(const DCRTPoly &) = delete;
         DCRTPoly &operator=(DCRTPoly &&) = delete;
 
         [[nodiscard]] const lbcrypto::DCRTPoly &GetPoly() const noexcept;
+        [[nodiscard]] lbcrypto::DCRTPoly &GetPoly() noexcept;
+        // Heap-allocated non-owning wrappers for handing borrowed entries to Rust; only the
+        // wrapper is allocated, the towers are not copied.
+        [[nodiscard]] static std::unique_ptr<DCRTPoly> Borrow(const lbcrypto::DCRTPoly &poly);
+        [[nodiscard]] static std::unique_ptr<DCRTPoly> Borrow(lbcrypto::DCRTPoly &poly);
+        [[nodiscard]] bool IsBorrowed() const noexcept;
         [[nodiscard]] rust::String GetString() const;
         [[nodiscard]] bool IsEqual(const DCRTPoly &other) const noexcept;
         [[nodiscard]] rust::Vec<rust::String> GetCoefficients() const;
         [[nodiscard]] rust::Vec<rust::u8> GetCoefficientsBytes() const;
         [[nodiscard]] rust::String GetModulus() const;
+        [[nodiscard]] size_t GetNumOfTowers() const noexcept;
+        [[nodiscard]] size_t GetRingDimension() const noexcept;
+        [[nodiscard]] Format GetFormat() const noexcept;
+        // Borrowed view of one tower's residues in the poly's current format.
+        [[nodiscard]] rust::Slice<const uint64_t> GetTowerValues(size_t towerIdx) const;
+        // Writes every tower, tower-major, into `out` (size * n values) in the requested format.
+        void WriteTowersInto(Format format, rust::Slice<uint64_t> out) const;
+        // CRT-interpolated coefficients as fixed-width little-endian limbs, n * limbsPerInt values
+        // in the layout DCRTPolyGenFromVec consumes.
+        void WriteCoefficientsLimbsInto(size_t limbsPerInt, rust::Slice<uint64_t> out) const;
         [[nodiscard]] std::unique_ptr<DCRTPoly> Negate() const;
+
+        // Explicit NTT / inverse NTT of every tower; a no-op if already in `format`.
+        void SetFormat(Format format);
+
+        // In-place arithmetic; operands must share params and format.
+        void AddAssign(const DCRTPoly &rhs);
+        void SubAssign(const DCRTPoly &rhs);
+        void MulAssign(const DCRTPoly &rhs);
+        void ScalarMulAssign(uint64_t scalar);
+        // Scalar given as little-endian u64 limbs, reduced into every tower.
+        void ScalarMulLimbsAssign(rust::Slice<const uint64_t> scalarLimbs);
         [[nodiscard]] std::unique_ptr<Matrix> Decompose(uint32_t baseBits) const;
+        // Number of digit polys Decompose / DecomposeInto produce for `baseBits`.
+        [[nodiscard]] size_t GetDecomposeLength(uint32_t baseBits) const;
+        // Writes the same digits as Decompose into `out`, starting at (row, col) and running
+        // down a column when `column` is set or along the row otherwise, each digit in `format`.
+        void DecomposeInto(uint32_t baseBits, Matrix &out, size_t row, size_t col, bool column, Format format) const;
     };
 
     // Generator functions
@@ -55,14 +101,59 @@ namespace openfhe
         rust::Slice<const uint64_t> values_limbs,
         size_t limbs_per_int);
 
+    // Generate a polynomial from residues already in RNS form: `size` consecutive slices of
+    // n COEFFICIENT values, one per tower. Returns the DCRTPoly in EVALUATION format.
+    [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyGenFromRnsVec(
+        usint n,
+        size_t size,
+        size_t kRes,
+        rust::Slice<const uint64_t> residues);
+
+    // Same layout as DCRTPolyGenFromRnsVec, with the residues taken as EVALUATION slots.
+    [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyGenFromRnsEvalVec(
+        usint n,
+        size_t size,
+        size_t kRes,
+        rust::Slice<const uint64_t> residues);
+
+    // C++-side builder shared by the generators and the matrix file reader: `residues` holds
+    // size * n values, tower-major, interpreted in `format`.
+    [[nodiscard]] lbcrypto::DCRTPoly DCRTPolyFromRnsResidues(
+        const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params,
+        const Format format,
+        rust::Slice<const uint64_t> residues);
+
+    // n signed integers reduced into every tower (negatives as q - |x| mod q) and returned in
+    // `format`. Values below every tower modulus in magnitude skip the reduction.
+    [[nodiscard]] lbcrypto::DCRTPoly DCRTPolyFromSmallIntegers(
+        const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params,
+        const Format format,
+        rust::Slice<const int64_t> coeffs);
+
     [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyGenFromBug(usint n, size_t size, size_t kRes);
     [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyGenFromDug(usint n, size_t size, size_t kRes);
     [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyGenFromDgg(usint n, size_t size, size_t kRes, double sigma);
     [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyGenFromTug(usint n, size_t size, size_t kRes);
+    // Uniform poly in EVALUATION format expanded from a 32-byte seed; the same (seed, stream)
+    // always gives the same poly, equal to entry (0, 0) of MatrixGenFromDugSeeded.
+    [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyGenFromDugSeeded(
+        usint n,
+        size_t size,
+        size_t kRes,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream);
 
     // Arithmetic
     [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyAdd(const DCRTPoly &rhs, const DCRTPoly &lhs);
     [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyMul(const DCRTPoly &rhs, const DCRTPoly &lhs);
+    // lhs - rhs
+    [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolySub(const DCRTPoly &lhs, const DCRTPoly &rhs);
+    [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyScalarMul(const DCRTPoly &poly, uint64_t scalar);
+    [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyScalarMulLimbs(
+        const DCRTPoly &poly,
+        rust::Slice<const uint64_t> scalarLimbs);
+    // acc += a * b, tower by tower without temporaries; all three must be in EVALUATION format.
+    void DCRTPolyMulAdd(DCRTPoly &acc, const DCRTPoly &a, const DCRTPoly &b);
 
     class DCRTPolyParams final
     {
@@ -79,9 +170,67 @@ namespace openfhe
         [[nodiscard]] const std::shared_ptr<lbcrypto::DCRTPoly::Params> &GetRef() const noexcept;
     };
 
+    // Descriptor of an RNS basis, built once per params and cached with them: the primes q_t,
+    // Q = prod q_t as little-endian u64 limbs, and the CRT reconstruction constants Q/q_t (as
+    // limbs, towers x modulus limbs) and [(Q/q_t)^-1]_{q_t}.
+    class CRTBasis final
+    {
+        std::shared_ptr<lbcrypto::DCRTPoly::Params> m_params;
+        std::vector<uint64_t> m_moduli;
+        std::vector<uint64_t> m_modulusLimbs;
+        std::vector<uint64_t> m_qHat;
+        std::vector<uint64_t> m_qHatInv;
+        std::vector<lbcrypto::NativeInteger> m_qHatInvNative;
+        std::vector<lbcrypto::NativeInteger> m_qHatInvPrecon;
+        std::vector<double> m_qInv;
+
+    public:
+        explicit CRTBasis(const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params);
+        CRTBasis(const CRTBasis &) = delete;
+        CRTBasis(CRTBasis &&) = delete;
+        CRTBasis &operator=(const CRTBasis &) = delete;
+        CRTBasis &operator=(CRTBasis &&) = delete;
+
+        [[nodiscard]] const std::shared_ptr<lbcrypto::DCRTPoly::Params> &GetParams() const noexcept;
+        [[nodiscard]] usint GetRingDimension() const noexcept;
+        [[nodiscard]] rust::Slice<const uint64_t> GetModuli() const noexcept;
+        [[nodiscard]] rust::Slice<const uint64_t> GetModulusLimbs() const noexcept;
+        [[nodiscard]] rust::Slice<const uint64_t> GetQHat() const noexcept;
+        [[nodiscard]] rust::Slice<const uint64_t> GetQHatInv() const noexcept;
+        // [(Q/q_t)^-1]_{q_t} with Shoup companions, and 1/q_t for quotient estimates
+        [[nodiscard]] const std::vector<lbcrypto::NativeInteger> &GetQHatInvNative() const noexcept;
+        [[nodiscard]] const std::vector<lbcrypto::NativeInteger> &GetQHatInvPrecon() const noexcept;
+        [[nodiscard]] const std::vector<double> &GetQInv() const noexcept;
+    };
+
     // Generator functions
     [[nodiscard]] std::unique_ptr<DCRTPolyParams> DCRTPolyGenNullParams();
 
+    // Returns a handle to the process-wide cached ILDCRTParams for (n, size, kRes).
+    [[nodiscard]] std::unique_ptr<DCRTPolyParams> DCRTPolyGenParams(usint n, size_t size, size_t kRes);
+
+    // Drops every cached ILDCRTParams and CRTBasis; handles and polynomials already built keep
+    // their params alive.
+    void DCRTPolyClearParamsCache();
+
+    // Shared handle to the cached CRTBasis for (n, size, kRes).
+    [[nodiscard]] std::shared_ptr<CRTBasis> DCRTPolyGenCRTBasis(usint n, size_t size, size_t kRes);
+
+    // Thread-safe lookup used by every entry point that builds ILDCRTParams from (n, size, kRes).
+    // Prime generation, root-of-unity search and the CRT constants run once per distinct triple.
+    [[nodiscard]] std::shared_ptr<CRTBasis> GetCRTBasis(
+        usint n,
+        size_t size,
+        size_t kRes);
+    // Basis of any params. Params from the cache above are found by identity, lock-free on a repeat
+    // lookup from the same thread; params built elsewhere (e.g. a crypto context's element params)
+    // get a fresh, uncached basis so the cache never keeps them alive.
+    [[nodiscard]] std::shared_ptr<CRTBasis> GetCRTBasis(const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params);
+    [[nodiscard]] std::shared_ptr<lbcrypto::DCRTPoly::Params> GetDCRTPolyParams(
+        usint n,
+        size_t size,
+        size_t kRes);
+
     // Matrix functions
     [[nodiscard]] std::unique_ptr<Matrix> MatrixGen(
         usint n,
@@ -90,12 +239,46 @@ namespace openfhe
         size_t nrow,
         size_t ncol);
 
+    // Uniform EVALUATION-format matrix expanded from (seed, stream). Entry (i, j) is drawn from
+    // keystream block (i * ncol + j) << 32 onwards, so entries expand independently and in parallel
+    // straight into their towers.
+    [[nodiscard]] Matrix UniformMatrixFromSeed(
+        const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params,
+        size_t nrow,
+        size_t ncol,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream);
+
+    [[nodiscard]] std::unique_ptr<Matrix> MatrixGenFromDugSeeded(
+        usint n,
+        size_t size,
+        size_t kRes,
+        size_t nrow,
+        size_t ncol,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream);
+
     std::unique_ptr<Matrix> GetMatrixFromFs(
         usint n,
         size_t size,
         size_t kRes,
         const rust::String &path);
 
+    // In-memory serialization straight into / out of Rust buffers. Deserialization returns null
+    // on malformed input; matrices get the EVALUATION allocator of (n, size, kRes) as with
+    // GetMatrixFromFs.
+    [[nodiscard]] rust::Vec<uint8_t> DCRTPolySerializeToBytes(const DCRTPoly &poly, const SerialMode serialMode);
+    [[nodiscard]] std::unique_ptr<DCRTPoly> DCRTPolyDeserializeFromBytes(
+        rust::Slice<const uint8_t> data,
+        const SerialMode serialMode);
+    [[nodiscard]] rust::Vec<uint8_t> MatrixSerializeToBytes(const Matrix &matrix, const SerialMode serialMode);
+    [[nodiscard]] std::unique_ptr<Matrix> MatrixDeserializeFromBytes(
+        usint n,
+        size_t size,
+        size_t kRes,
+        rust::Slice<const uint8_t> data,
+        const SerialMode serialMode);
+
     void SetMatrixElement(
         Matrix &matrix,
         size_t row,
@@ -107,8 +290,28 @@ namespace openfhe
         size_t row,
         size_t col);
 
+    // Non-owning entry views, valid for as long as the matrix is neither resized nor dropped.
+    [[nodiscard]] std::unique_ptr<DCRTPoly> GetMatrixElementRef(
+        const Matrix &matrix,
+        size_t row,
+        size_t col);
+    [[nodiscard]] std::unique_ptr<DCRTPoly> GetMatrixElementMut(
+        Matrix &matrix,
+        size_t row,
+        size_t col);
+
+    // Moves `element` into the matrix instead of copying it.
+    void SetMatrixElementOwned(
+        Matrix &matrix,
+        size_t row,
+        size_t col,
+        std::unique_ptr<DCRTPoly> element);
+
     size_t GetMatrixRows(const Matrix &matrix);
     size_t GetMatrixCols(const Matrix &matrix);
+    // Copies through MatrixView::Materialize. ExtractMatrixRows is inclusive of `endRow` like
+    // lbcrypto::Matrix::ExtractRows; ExtractMatrixCols excludes `endCol`, but `startCol == endCol`
+    // yields that single column.
     std::unique_ptr<Matrix> ExtractMatrixRow(
         const Matrix &matrix,
         size_t row);
@@ -126,4 +329,84 @@ namespace openfhe
 
     void FormatMatrixCoefficient(
         Matrix &matrix);
+
+    // Converts every entry to `format` in place, NTTs running in parallel over entry x tower.
+    void FormatMatrix(
+        Matrix &matrix,
+        Format format);
+
+    // Rectangular window [startRow, endRow) x [startCol, endCol) over a Matrix owned elsewhere.
+    // Holds a plain pointer: the matrix must outlive the view and must not be resized meanwhile.
+    class MatrixView final
+    {
+        const Matrix *m_matrix;
+        size_t m_rowOffset;
+        size_t m_colOffset;
+        size_t m_rows;
+        size_t m_cols;
+
+    public:
+        MatrixView(const Matrix &matrix, size_t startRow, size_t endRow, size_t startCol, size_t endCol);
+        MatrixView(const MatrixView &) = delete;
+        MatrixView(MatrixView &&) = delete;
+        MatrixView &operator=(const MatrixView &) = delete;
+        MatrixView &operator=(MatrixView &&) = delete;
+
+        [[nodiscard]] size_t GetRows() const noexcept;
+        [[nodiscard]] size_t GetCols() const noexcept;
+        [[nodiscard]] const lbcrypto::DCRTPoly &operator()(size_t row, size_t col) const;
+        [[nodiscard]] std::unique_ptr<DCRTPoly> GetElementRef(size_t row, size_t col) const;
+        // Ranges are relative to this view; the result points at the same matrix.
+        [[nodiscard]] std::unique_ptr<MatrixView> SubView(
+            size_t startRow,
+            size_t endRow,
+            size_t startCol,
+            size_t endCol) const;
+        [[nodiscard]] std::unique_ptr<Matrix> Materialize() const;
+    };
+
+    [[nodiscard]] std::unique_ptr<MatrixView> MatrixViewGen(
+        const Matrix &matrix,
+        size_t startRow,
+        size_t endRow,
+        size_t startCol,
+        size_t endCol);
+
+    // Matrix arithmetic. Every entry must be in EVALUATION format and share the same params.
+    [[nodiscard]] std::unique_ptr<Matrix> MatrixMul(const Matrix &a, const Matrix &b);
+    // c += a * b without materialising the product
+    void MatrixMulAccumulate(Matrix &c, const Matrix &a, const Matrix &b);
+    [[nodiscard]] std::unique_ptr<Matrix> MatrixAdd(const Matrix &a, const Matrix &b);
+    [[nodiscard]] std::unique_ptr<Matrix> MatrixSub(const Matrix &a, const Matrix &b);
+    // Multiplies every entry by the ring element `scalar`
+    [[nodiscard]] std::unique_ptr<Matrix> MatrixScalarMul(const Matrix &matrix, const DCRTPoly &scalar);
+    // Product of two views, without materialising either operand
+    [[nodiscard]] std::unique_ptr<Matrix> MatrixViewMul(const MatrixView &a, const MatrixView &b);
+
+    // Entry (i, j) of `matrix` expanded into the digit column block [i * k, (i + 1) * k) x j of a
+    // (k * rows) x cols result, k = GetDecomposeLength(baseBits); parallel over entries and towers.
+    [[nodiscard]] std::unique_ptr<Matrix> MatrixDecompose(const Matrix &matrix, uint32_t baseBits, Format format);
+
+    // Digits D per tower of the CRT gadget for `base`. Without balancing D is OpenFHE's
+    // GadgetVector digit count, so DCRTPolyGadgetVector(n, size, kRes, size * D, base) is the
+    // matching gadget row; balanced digits add a carry digit that only GadgetMul and
+    // GadgetMulTranspose (len = size * D) account for.
+    [[nodiscard]] size_t GadgetDigitsPerTower(
+        usint n,
+        size_t size,
+        size_t kRes,
+        int64_t base,
+        bool balanced);
+
+    // G^{-1}(matrix) for an integer base in [2, 2^31): entry (i, j) becomes the k digits in rows
+    // [i * k, (i + 1) * k) of column j, k = size * D, tower-major, in EVALUATION format. Digits
+    // are taken from the RNS residues directly; balanced digits lie in (-b/2, b/2].
+    [[nodiscard]] std::unique_ptr<Matrix> MatrixGadgetDecompose(const Matrix &matrix, int64_t base, bool balanced);
+
+    // X * G and G * X for G = I (x) g, g = DCRTPolyGadgetVector(n, size, kRes, len, base), without
+    // materialising G: every gadget entry is b^l in one tower and zero elsewhere, so each product
+    // is a per-tower scalar multiply-accumulate. Entries must be in EVALUATION format. GadgetMul
+    // maps r x m to r x (m * len); GadgetMulTranspose maps (m * len) x c to m x c.
+    [[nodiscard]] std::unique_ptr<Matrix> GadgetMul(const Matrix &matrix, int64_t base, size_t len);
+    [[nodiscard]] std::unique_ptr<Matrix> GadgetMulTranspose(const Matrix &matrix, int64_t base, size_t len);
 } // openfhe
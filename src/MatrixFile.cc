@@ -0,0 +1,600 @@
+#include "MatrixFile.h"
+#include "Prng.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+// Matrix files hold native u64 words, which is the documented little-endian layout only here
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "matrix files require a little-endian host");
+
+namespace openfhe
+{
+
+    namespace
+    {
+        constexpr size_t FIXED_HEADER_WORDS = 7;
+        constexpr size_t SEEDED_FIXED_HEADER_WORDS = 11;
+        constexpr size_t SEED_WORDS = PRNG_SEED_BYTES / sizeof(uint64_t);
+
+        size_t CheckedMul(size_t a, size_t b)
+        {
+            size_t result;
+            if (__builtin_mul_overflow(a, b, &result))
+            {
+                throw std::runtime_error("matrix file size overflows");
+            }
+            return result;
+        }
+
+        size_t CheckedAdd(size_t a, size_t b)
+        {
+            size_t result;
+            if (__builtin_add_overflow(a, b, &result))
+            {
+                throw std::runtime_error("matrix file size overflows");
+            }
+            return result;
+        }
+
+        // Closes the descriptor unless released, so a constructor that throws after open() does
+        // not leak it
+        class FdGuard final
+        {
+            int m_fd;
+
+        public:
+            explicit FdGuard(int fd) noexcept : m_fd(fd) {}
+            FdGuard(const FdGuard &) = delete;
+            FdGuard &operator=(const FdGuard &) = delete;
+            ~FdGuard()
+            {
+                if (m_fd >= 0)
+                {
+                    ::close(m_fd);
+                }
+            }
+
+            [[nodiscard]] int Get() const noexcept
+            {
+                return m_fd;
+            }
+
+            int Release() noexcept
+            {
+                const int fd = m_fd;
+                m_fd = -1;
+                return fd;
+            }
+        };
+
+        uint64_t ReadFileMagic(const std::string &path)
+        {
+            std::ifstream in(path, std::ios::binary);
+            uint64_t magic = 0;
+            in.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+            return in.gcount() == sizeof(magic) ? magic : 0;
+        }
+
+        uint64_t FormatTag(Format format)
+        {
+            return format == Format::EVALUATION ? 0 : 1;
+        }
+
+        Format FormatFromTag(uint64_t tag)
+        {
+            if (tag > 1)
+            {
+                throw std::runtime_error("matrix file has an unknown format tag");
+            }
+            return tag == 0 ? Format::EVALUATION : Format::COEFFICIENT;
+        }
+
+        MatrixFileHeader DecodeMatrixFileHeader(const uint64_t *words, size_t availableWords)
+        {
+            if (availableWords > 0 && words[0] == SEEDED_MATRIX_FILE_MAGIC)
+            {
+                throw std::runtime_error("seeded matrix files hold no residues; load them with GetMatrixFromFs");
+            }
+            if (availableWords < FIXED_HEADER_WORDS || words[0] != MATRIX_FILE_MAGIC)
+            {
+                throw std::runtime_error("not a matrix file");
+            }
+            if (words[1] != MATRIX_FILE_VERSION)
+            {
+                throw std::runtime_error("unsupported matrix file version");
+            }
+
+            MatrixFileHeader header;
+            header.ringDim = words[2];
+            header.towers = words[3];
+            header.rows = words[4];
+            header.cols = words[5];
+            header.format = FormatFromTag(words[6]);
+            if (header.towers > availableWords - FIXED_HEADER_WORDS)
+            {
+                throw std::runtime_error("matrix file header is truncated");
+            }
+            header.moduli.assign(words + FIXED_HEADER_WORDS, words + FIXED_HEADER_WORDS + header.towers);
+            return header;
+        }
+    } // namespace
+
+    size_t MatrixFileHeader::HeaderWords() const noexcept
+    {
+        return FIXED_HEADER_WORDS + moduli.size();
+    }
+
+    size_t MatrixFileHeader::ElementWords() const noexcept
+    {
+        return ringDim * towers;
+    }
+
+    size_t MatrixFileHeader::TotalWords() const
+    {
+        const size_t elementWords = CheckedMul(ringDim, towers);
+        const size_t total = CheckedAdd(HeaderWords(), CheckedMul(CheckedMul(rows, cols), elementWords));
+        if (total > static_cast<size_t>(std::numeric_limits<off_t>::max()) / sizeof(uint64_t))
+        {
+            throw std::runtime_error("matrix file size overflows");
+        }
+        return total;
+    }
+
+    MatrixFileHeader MakeMatrixFileHeader(
+        const lbcrypto::DCRTPoly::Params &params,
+        size_t rows,
+        size_t cols,
+        Format format)
+    {
+        MatrixFileHeader header;
+        header.ringDim = params.GetRingDimension();
+        header.towers = params.GetParams().size();
+        header.rows = rows;
+        header.cols = cols;
+        header.format = format;
+        for (const auto &towerParams : params.GetParams())
+        {
+            header.moduli.push_back(towerParams->GetModulus().ConvertToInt<uint64_t>());
+        }
+        return header;
+    }
+
+    std::vector<uint64_t> EncodeMatrixFileHeader(const MatrixFileHeader &header)
+    {
+        std::vector<uint64_t> words = {
+            MATRIX_FILE_MAGIC,
+            MATRIX_FILE_VERSION,
+            header.ringDim,
+            header.towers,
+            header.rows,
+            header.cols,
+            FormatTag(header.format)};
+        words.insert(words.end(), header.moduli.begin(), header.moduli.end());
+        return words;
+    }
+
+    void CheckMatrixFileHeader(const MatrixFileHeader &header, const lbcrypto::DCRTPoly::Params &params)
+    {
+        const MatrixFileHeader expected = MakeMatrixFileHeader(params, header.rows, header.cols, header.format);
+        if (header.ringDim != expected.ringDim || header.moduli != expected.moduli)
+        {
+            throw std::runtime_error("matrix file was written for different params");
+        }
+    }
+
+    bool IsMatrixFile(const std::string &path)
+    {
+        return ReadFileMagic(path) == MATRIX_FILE_MAGIC;
+    }
+
+    void WriteMatrixFile(const Matrix &matrix, const std::string &path)
+    {
+        if (matrix.GetRows() == 0 || matrix.GetCols() == 0)
+        {
+            throw std::runtime_error("cannot write an empty matrix");
+        }
+
+        const lbcrypto::DCRTPoly &first = matrix(0, 0);
+        MatrixFileWriter writer(
+            path, *first.GetParams(), matrix.GetRows(), matrix.GetCols(), first.GetFormat(), SYNC_NONE);
+        for (size_t i = 0; i < matrix.GetRows(); ++i)
+        {
+            for (size_t j = 0; j < matrix.GetCols(); ++j)
+            {
+                writer.WriteElement(i, j, DCRTPoly(DCRTPoly::Borrowed{}, matrix(i, j)));
+            }
+        }
+        writer.Finish();
+    }
+
+    void WriteSeededMatrixFile(
+        const lbcrypto::DCRTPoly::Params &params,
+        size_t rows,
+        size_t cols,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream,
+        const std::string &path)
+    {
+        if (seed.size() != PRNG_SEED_BYTES)
+        {
+            throw std::runtime_error("PRNG seed must be 32 bytes");
+        }
+
+        const MatrixFileHeader header = MakeMatrixFileHeader(params, rows, cols, Format::EVALUATION);
+        std::vector<uint64_t> words = {
+            SEEDED_MATRIX_FILE_MAGIC,
+            MATRIX_FILE_VERSION,
+            header.ringDim,
+            header.towers,
+            header.rows,
+            header.cols,
+            stream};
+        uint64_t seedWords[SEED_WORDS];
+        std::memcpy(seedWords, seed.data(), PRNG_SEED_BYTES);
+        words.insert(words.end(), seedWords, seedWords + SEED_WORDS);
+        words.insert(words.end(), header.moduli.begin(), header.moduli.end());
+
+        std::filesystem::path fsPath(path);
+        if (fsPath.has_parent_path())
+        {
+            std::filesystem::create_directories(fsPath.parent_path());
+        }
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(words.data()), static_cast<std::streamsize>(words.size() * sizeof(uint64_t)));
+        if (!out)
+        {
+            throw std::runtime_error("Failed to write seeded matrix file");
+        }
+    }
+
+    bool IsSeededMatrixFile(const std::string &path)
+    {
+        return ReadFileMagic(path) == SEEDED_MATRIX_FILE_MAGIC;
+    }
+
+    Matrix ReadSeededMatrixFile(
+        const std::string &path,
+        const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params)
+    {
+        std::ifstream in(path, std::ios::binary);
+        uint64_t fixed[SEEDED_FIXED_HEADER_WORDS];
+        in.read(reinterpret_cast<char *>(fixed), sizeof(fixed));
+        if (in.gcount() != sizeof(fixed) || fixed[0] != SEEDED_MATRIX_FILE_MAGIC)
+        {
+            throw std::runtime_error("not a seeded matrix file");
+        }
+        if (fixed[1] != MATRIX_FILE_VERSION)
+        {
+            throw std::runtime_error("unsupported matrix file version");
+        }
+
+        MatrixFileHeader header;
+        header.ringDim = fixed[2];
+        header.towers = fixed[3];
+        header.rows = fixed[4];
+        header.cols = fixed[5];
+        // The tower count sizes an allocation, so it is checked before anything is read with it
+        if (header.towers != params->GetParams().size())
+        {
+            throw std::runtime_error("matrix file was written for different params");
+        }
+        header.moduli.resize(header.towers);
+        const std::streamsize moduliBytes = static_cast<std::streamsize>(header.towers * sizeof(uint64_t));
+        in.read(reinterpret_cast<char *>(header.moduli.data()), moduliBytes);
+        if (in.gcount() != moduliBytes)
+        {
+            throw std::runtime_error("matrix file header is truncated");
+        }
+        CheckMatrixFileHeader(header, *params);
+
+        // the seed follows the stream word
+        uint8_t seed[PRNG_SEED_BYTES];
+        std::memcpy(seed, fixed + 7, PRNG_SEED_BYTES);
+        return UniformMatrixFromSeed(
+            params, header.rows, header.cols, rust::Slice<const uint8_t>(seed, PRNG_SEED_BYTES), fixed[6]);
+    }
+
+    MatrixFileWriter::MatrixFileWriter(
+        const std::string &path,
+        const lbcrypto::DCRTPoly::Params &params,
+        size_t rows,
+        size_t cols,
+        Format format,
+        MatrixFileSync sync)
+        : m_header(MakeMatrixFileHeader(params, rows, cols, format)), m_sync(sync)
+    {
+        const size_t totalWords = m_header.TotalWords();
+        std::filesystem::path fsPath(path);
+        if (fsPath.has_parent_path())
+        {
+            std::filesystem::create_directories(fsPath.parent_path());
+        }
+
+        FdGuard fd(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644));
+        if (fd.Get() < 0)
+        {
+            throw std::runtime_error("Failed to open matrix file for writing");
+        }
+
+        const std::vector<uint64_t> headerWords = EncodeMatrixFileHeader(m_header);
+        if (::ftruncate(fd.Get(), static_cast<off_t>(totalWords * sizeof(uint64_t))) != 0)
+        {
+            throw std::runtime_error("Failed to size matrix file");
+        }
+        m_fd = fd.Get();
+        WriteWords(headerWords.data(), headerWords.size(), 0);
+        fd.Release();
+    }
+
+    MatrixFileWriter::~MatrixFileWriter()
+    {
+        if (m_fd >= 0)
+        {
+            ::close(m_fd);
+        }
+    }
+
+    void MatrixFileWriter::WriteWords(const uint64_t *words, size_t count, size_t offsetWords) const
+    {
+        if (m_fd < 0)
+        {
+            throw std::runtime_error("matrix file writer is already finished");
+        }
+
+        const char *data = reinterpret_cast<const char *>(words);
+        size_t remaining = count * sizeof(uint64_t);
+        off_t offset = static_cast<off_t>(offsetWords * sizeof(uint64_t));
+        while (remaining > 0)
+        {
+            const ssize_t written = ::pwrite(m_fd, data, remaining, offset);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                throw std::runtime_error("Failed to write matrix file");
+            }
+            data += written;
+            remaining -= static_cast<size_t>(written);
+            offset += written;
+        }
+    }
+
+    void MatrixFileWriter::WriteElement(size_t row, size_t col, const DCRTPoly &element)
+    {
+        if (row >= m_header.rows || col >= m_header.cols)
+        {
+            throw std::out_of_range("matrix index out of range");
+        }
+        const lbcrypto::DCRTPoly &poly = element.GetPoly();
+        if (poly.GetRingDimension() != m_header.ringDim || poly.GetNumOfElements() != m_header.towers)
+        {
+            throw std::runtime_error("element does not match the matrix file params");
+        }
+        for (size_t t = 0; t < m_header.towers; ++t)
+        {
+            if (poly.GetElementAtIndex(t).GetModulus().ConvertToInt<uint64_t>() != m_header.moduli[t])
+            {
+                throw std::runtime_error("element does not match the matrix file params");
+            }
+        }
+
+        const size_t elementWords = m_header.ElementWords();
+        std::vector<uint64_t> buffer(elementWords);
+        element.WriteTowersInto(m_header.format, rust::Slice<uint64_t>(buffer.data(), buffer.size()));
+        WriteWords(buffer.data(), elementWords, m_header.HeaderWords() + ((row * m_header.cols + col) * elementWords));
+    }
+
+    void MatrixFileWriter::WriteColumn(size_t col, const Matrix &column)
+    {
+        if (column.GetRows() != m_header.rows || column.GetCols() != 1)
+        {
+            throw std::runtime_error("column shape does not match the matrix file");
+        }
+        for (size_t i = 0; i < m_header.rows; ++i)
+        {
+            WriteElement(i, col, DCRTPoly(DCRTPoly::Borrowed{}, column(i, 0)));
+        }
+        if (m_sync == SYNC_EVERY_COLUMN)
+        {
+            std::lock_guard<std::mutex> lock(m_syncMutex);
+            if (::fdatasync(m_fd) != 0)
+            {
+                throw std::runtime_error("Failed to sync matrix file");
+            }
+        }
+    }
+
+    void MatrixFileWriter::Finish()
+    {
+        if (m_fd < 0)
+        {
+            return;
+        }
+        const bool syncFailed = m_sync != SYNC_NONE && ::fsync(m_fd) != 0;
+        const bool closeFailed = ::close(m_fd) != 0;
+        m_fd = -1;
+        if (syncFailed || closeFailed)
+        {
+            throw std::runtime_error("Failed to flush matrix file");
+        }
+    }
+
+    MappedMatrix::MappedMatrix(const std::string &path, std::shared_ptr<lbcrypto::DCRTPoly::Params> params)
+        : m_params(std::move(params))
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Failed to open matrix file");
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Failed to stat matrix file");
+        }
+        m_mappingLength = static_cast<size_t>(st.st_size);
+
+        m_mapping = ::mmap(nullptr, m_mappingLength, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (m_mapping == MAP_FAILED)
+        {
+            m_mapping = nullptr;
+            throw std::runtime_error("Failed to map matrix file");
+        }
+
+        try
+        {
+            const uint64_t *words = static_cast<const uint64_t *>(m_mapping);
+            const size_t totalWords = m_mappingLength / sizeof(uint64_t);
+            m_header = DecodeMatrixFileHeader(words, totalWords);
+            CheckMatrixFileHeader(m_header, *m_params);
+            if (totalWords < m_header.TotalWords())
+            {
+                throw std::runtime_error("matrix file is truncated");
+            }
+            m_elements = words + m_header.HeaderWords();
+        }
+        catch (...)
+        {
+            ::munmap(m_mapping, m_mappingLength);
+            m_mapping = nullptr;
+            throw;
+        }
+    }
+
+    MappedMatrix::~MappedMatrix()
+    {
+        if (m_mapping != nullptr)
+        {
+            ::munmap(m_mapping, m_mappingLength);
+        }
+    }
+
+    size_t MappedMatrix::GetRows() const noexcept
+    {
+        return m_header.rows;
+    }
+
+    size_t MappedMatrix::GetCols() const noexcept
+    {
+        return m_header.cols;
+    }
+
+    Format MappedMatrix::GetFormat() const noexcept
+    {
+        return m_header.format;
+    }
+
+    rust::Slice<const uint64_t> MappedMatrix::GetElementValues(size_t row, size_t col) const
+    {
+        if (row >= m_header.rows || col >= m_header.cols)
+        {
+            throw std::out_of_range("matrix index out of range");
+        }
+        const size_t elementWords = m_header.ElementWords();
+        return rust::Slice<const uint64_t>(m_elements + ((row * m_header.cols + col) * elementWords), elementWords);
+    }
+
+    rust::Slice<const uint64_t> MappedMatrix::GetTowerValues(size_t row, size_t col, size_t towerIdx) const
+    {
+        if (towerIdx >= m_header.towers)
+        {
+            throw std::out_of_range("tower index out of range");
+        }
+        const rust::Slice<const uint64_t> element = GetElementValues(row, col);
+        return rust::Slice<const uint64_t>(element.data() + (towerIdx * m_header.ringDim), m_header.ringDim);
+    }
+
+    std::unique_ptr<DCRTPoly> MappedMatrix::GetElement(size_t row, size_t col) const
+    {
+        return std::make_unique<DCRTPoly>(
+            DCRTPolyFromRnsResidues(m_params, m_header.format, GetElementValues(row, col)));
+    }
+
+    std::unique_ptr<Matrix> MappedMatrix::GetColumn(size_t col) const
+    {
+        if (col >= m_header.cols)
+        {
+            throw std::out_of_range("matrix column out of range");
+        }
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(m_params, Format::EVALUATION);
+        auto result = std::make_unique<Matrix>(zero_alloc, m_header.rows, 1);
+        for (size_t i = 0; i < m_header.rows; ++i)
+        {
+            (*result)(i, 0) = DCRTPolyFromRnsResidues(m_params, m_header.format, GetElementValues(i, col));
+        }
+        return result;
+    }
+
+    std::unique_ptr<Matrix> MappedMatrix::ToMatrix() const
+    {
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(m_params, Format::EVALUATION);
+        auto result = std::make_unique<Matrix>(zero_alloc, m_header.rows, m_header.cols);
+        const size_t entries = m_header.rows * m_header.cols;
+#pragma omp parallel for if (entries > 1)
+        for (long eL = 0; eL < static_cast<long>(entries); ++eL)
+        {
+            const size_t e = static_cast<size_t>(eL);
+            const size_t row = e / m_header.cols;
+            const size_t col = e % m_header.cols;
+            (*result)(row, col) = DCRTPolyFromRnsResidues(m_params, m_header.format, GetElementValues(row, col));
+        }
+        return result;
+    }
+
+    // Generator functions
+    std::unique_ptr<MappedMatrix> MappedMatrixOpen(
+        usint n,
+        size_t size,
+        size_t kRes,
+        const rust::String &path)
+    {
+        return std::make_unique<MappedMatrix>(std::string(path), GetDCRTPolyParams(n, size, kRes));
+    }
+
+    void MatrixWriteToFs(
+        const Matrix &matrix,
+        const rust::String &path)
+    {
+        WriteMatrixFile(matrix, std::string(path));
+    }
+
+    void MatrixWriteSeededToFs(
+        usint n,
+        size_t size,
+        size_t kRes,
+        size_t nrow,
+        size_t ncol,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream,
+        const rust::String &path)
+    {
+        WriteSeededMatrixFile(*GetDCRTPolyParams(n, size, kRes), nrow, ncol, seed, stream, std::string(path));
+    }
+
+    std::unique_ptr<MatrixFileWriter> MatrixFileWriterOpen(
+        usint n,
+        size_t size,
+        size_t kRes,
+        const rust::String &path,
+        size_t rows,
+        size_t cols,
+        Format format,
+        MatrixFileSync sync)
+    {
+        return std::make_unique<MatrixFileWriter>(
+            std::string(path), *GetDCRTPolyParams(n, size, kRes), rows, cols, format, sync);
+    }
+
+} // openfhe
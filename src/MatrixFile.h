@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "DCRTPoly.h"
+#include "rust/cxx.h"
+
+namespace openfhe
+{
+
+    // Fixed-layout matrix file, all fields little-endian u64 (only little-endian hosts are
+    // supported, words are written and mapped as-is):
+    //   magic, version, n, towers, rows, cols, format, moduli[towers]
+    // followed by rows * cols elements in row-major order, each element `towers` consecutive
+    // runs of n residues. Element (i, j) therefore lives at a fixed offset and can be mapped
+    // without parsing anything before it.
+    constexpr uint64_t MATRIX_FILE_MAGIC = 0x31584d54524344ULL; // "DCRTMX1\0"
+    constexpr uint64_t MATRIX_FILE_VERSION = 1;
+
+    // Seed-only file for a uniform matrix from UniformMatrixFromSeed, little-endian u64 words:
+    //   magic, version, n, towers, rows, cols, stream, seed[4], moduli[towers]
+    // Its size does not depend on the matrix shape; readers expand the entries on load.
+    constexpr uint64_t SEEDED_MATRIX_FILE_MAGIC = 0x31534d54524344ULL; // "DCRTMS1\0"
+
+    // When a MatrixFileWriter flushes to stable storage. SYNC_EVERY_COLUMN issues one
+    // fdatasync per finished column; concurrent writers take turns, so with many short columns
+    // the syncs, not the sampling, bound throughput.
+    enum MatrixFileSync
+    {
+        SYNC_NONE = 0,
+        SYNC_ON_FINISH = 1,
+        SYNC_EVERY_COLUMN = 2,
+    };
+
+    struct MatrixFileHeader
+    {
+        uint64_t ringDim = 0;
+        uint64_t towers = 0;
+        uint64_t rows = 0;
+        uint64_t cols = 0;
+        Format format = Format::EVALUATION;
+        std::vector<uint64_t> moduli;
+
+        [[nodiscard]] size_t HeaderWords() const noexcept;
+        [[nodiscard]] size_t ElementWords() const noexcept;
+        // Header plus every element; throws if the size does not fit in size_t (or off_t bytes).
+        [[nodiscard]] size_t TotalWords() const;
+    };
+
+    [[nodiscard]] MatrixFileHeader MakeMatrixFileHeader(
+        const lbcrypto::DCRTPoly::Params &params,
+        size_t rows,
+        size_t cols,
+        Format format);
+    [[nodiscard]] std::vector<uint64_t> EncodeMatrixFileHeader(const MatrixFileHeader &header);
+    // Throws if the header does not match `params`.
+    void CheckMatrixFileHeader(const MatrixFileHeader &header, const lbcrypto::DCRTPoly::Params &params);
+
+    // True if `path` starts with the matrix file magic.
+    [[nodiscard]] bool IsMatrixFile(const std::string &path);
+
+    // Writes `matrix` in the fixed layout; entries are stored in the format of entry (0, 0).
+    void WriteMatrixFile(const Matrix &matrix, const std::string &path);
+
+    void WriteSeededMatrixFile(
+        const lbcrypto::DCRTPoly::Params &params,
+        size_t rows,
+        size_t cols,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream,
+        const std::string &path);
+    // True if `path` starts with the seeded matrix file magic.
+    [[nodiscard]] bool IsSeededMatrixFile(const std::string &path);
+    [[nodiscard]] Matrix ReadSeededMatrixFile(
+        const std::string &path,
+        const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params);
+
+    // Streams elements into a matrix file as they are produced. The file is sized up front, so
+    // elements and columns can arrive in any order and from several threads at once (as long as
+    // each element is written by one thread); memory use is one element buffer per call.
+    class MatrixFileWriter final
+    {
+        MatrixFileHeader m_header;
+        MatrixFileSync m_sync;
+        int m_fd = -1;
+        // Serialises the per-column fdatasync between threads writing different columns
+        std::mutex m_syncMutex;
+
+        void WriteWords(const uint64_t *words, size_t count, size_t offsetWords) const;
+
+    public:
+        MatrixFileWriter(
+            const std::string &path,
+            const lbcrypto::DCRTPoly::Params &params,
+            size_t rows,
+            size_t cols,
+            Format format,
+            MatrixFileSync sync);
+        MatrixFileWriter(const MatrixFileWriter &) = delete;
+        MatrixFileWriter(MatrixFileWriter &&) = delete;
+        MatrixFileWriter &operator=(const MatrixFileWriter &) = delete;
+        MatrixFileWriter &operator=(MatrixFileWriter &&) = delete;
+        ~MatrixFileWriter();
+
+        void WriteElement(size_t row, size_t col, const DCRTPoly &element);
+        // `column` is a rows x 1 matrix.
+        void WriteColumn(size_t col, const Matrix &column);
+        // Syncs according to the policy and closes the file; further writes throw.
+        void Finish();
+    };
+
+    // Read-only memory map of a matrix file. Nothing is read until an element is touched,
+    // and borrowed tower slices point straight into the page cache.
+    class MappedMatrix final
+    {
+        std::shared_ptr<lbcrypto::DCRTPoly::Params> m_params;
+        MatrixFileHeader m_header;
+        void *m_mapping = nullptr;
+        size_t m_mappingLength = 0;
+        const uint64_t *m_elements = nullptr;
+
+    public:
+        MappedMatrix(const std::string &path, std::shared_ptr<lbcrypto::DCRTPoly::Params> params);
+        MappedMatrix(const MappedMatrix &) = delete;
+        MappedMatrix(MappedMatrix &&) = delete;
+        MappedMatrix &operator=(const MappedMatrix &) = delete;
+        MappedMatrix &operator=(MappedMatrix &&) = delete;
+        ~MappedMatrix();
+
+        [[nodiscard]] size_t GetRows() const noexcept;
+        [[nodiscard]] size_t GetCols() const noexcept;
+        [[nodiscard]] Format GetFormat() const noexcept;
+        // All towers of element (row, col), tower-major (size * n values).
+        [[nodiscard]] rust::Slice<const uint64_t> GetElementValues(size_t row, size_t col) const;
+        [[nodiscard]] rust::Slice<const uint64_t> GetTowerValues(size_t row, size_t col, size_t towerIdx) const;
+        [[nodiscard]] std::unique_ptr<DCRTPoly> GetElement(size_t row, size_t col) const;
+        [[nodiscard]] std::unique_ptr<Matrix> GetColumn(size_t col) const;
+        [[nodiscard]] std::unique_ptr<Matrix> ToMatrix() const;
+    };
+
+    // Generator functions
+    [[nodiscard]] std::unique_ptr<MappedMatrix> MappedMatrixOpen(
+        usint n,
+        size_t size,
+        size_t kRes,
+        const rust::String &path);
+
+    void MatrixWriteToFs(
+        const Matrix &matrix,
+        const rust::String &path);
+
+    void MatrixWriteSeededToFs(
+        usint n,
+        size_t size,
+        size_t kRes,
+        size_t nrow,
+        size_t ncol,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream,
+        const rust::String &path);
+
+    [[nodiscard]] std::unique_ptr<MatrixFileWriter> MatrixFileWriterOpen(
+        usint n,
+        size_t size,
+        size_t kRes,
+        const rust::String &path,
+        size_t rows,
+        size_t cols,
+        Format format,
+        MatrixFileSync sync);
+} // openfhe
@@ -50,7 +50,7 @@ std::unique_ptr<ParamsCKKSRNS> GenParamsCKKSRNSbyVectorOfString(
 rust::String GenModulus(
     usint n, size_t size, size_t kRes)
 {
-    auto params        = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+    auto params = GetDCRTPolyParams(n, size, kRes);
     return rust::String(params->GetModulus().ToString());
 }
 
@@ -60,10 +60,7 @@ rust::Vec<rust::String> GenCRTBasis(
         std::size_t depth,
         std::size_t bits) {
 
-    using lbcrypto::BigInteger;
-    using lbcrypto::ILDCRTParams;
-
-    auto params = std::make_shared<ILDCRTParams<BigInteger>>(2 * n, depth, bits);
+    auto params = GetDCRTPolyParams(n, depth, bits);
 
     rust::Vec<rust::String> out;
     out.reserve(params->GetParams().size());
@@ -0,0 +1,164 @@
+#include "Prng.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace openfhe
+{
+    namespace
+    {
+        inline uint32_t Rotl(uint32_t v, int c) noexcept
+        {
+            return (v << c) | (v >> (32 - c));
+        }
+
+        // One quarter round on every lane; the lane loop is what gets vectorised
+        inline void QuarterRound(uint32_t (&x)[16][PRNG_BLOCKS], size_t a, size_t b, size_t c, size_t d) noexcept
+        {
+            for (size_t l = 0; l < PRNG_BLOCKS; l++)
+            {
+                x[a][l] += x[b][l];
+                x[d][l] = Rotl(x[d][l] ^ x[a][l], 16);
+                x[c][l] += x[d][l];
+                x[b][l] = Rotl(x[b][l] ^ x[c][l], 12);
+                x[a][l] += x[b][l];
+                x[d][l] = Rotl(x[d][l] ^ x[a][l], 8);
+                x[c][l] += x[d][l];
+                x[b][l] = Rotl(x[b][l] ^ x[c][l], 7);
+            }
+        }
+    } // namespace
+
+    ChaChaPrng::ChaChaPrng(rust::Slice<const uint8_t> seed, uint64_t stream)
+    {
+        if (seed.size() != PRNG_SEED_BYTES)
+        {
+            throw std::runtime_error("PRNG seed must be 32 bytes");
+        }
+
+        // "expand 32-byte k"
+        m_state[0] = 0x61707865;
+        m_state[1] = 0x3320646e;
+        m_state[2] = 0x79622d32;
+        m_state[3] = 0x6b206574;
+        for (size_t i = 0; i < 8; i++)
+        {
+            const uint8_t *b = seed.data() + (4 * i);
+            m_state[4 + i] = static_cast<uint32_t>(b[0]) | (static_cast<uint32_t>(b[1]) << 8) |
+                             (static_cast<uint32_t>(b[2]) << 16) | (static_cast<uint32_t>(b[3]) << 24);
+        }
+        m_state[12] = 0;
+        m_state[13] = 0;
+        m_state[14] = static_cast<uint32_t>(stream);
+        m_state[15] = static_cast<uint32_t>(stream >> 32);
+    }
+
+    void ChaChaPrng::Refill()
+    {
+        // lane l computes block counter + l
+        uint32_t input[16][PRNG_BLOCKS];
+        for (size_t w = 0; w < 16; w++)
+        {
+            for (size_t l = 0; l < PRNG_BLOCKS; l++)
+            {
+                input[w][l] = m_state[w];
+            }
+        }
+        for (size_t l = 0; l < PRNG_BLOCKS; l++)
+        {
+            const uint32_t lo = m_state[12] + static_cast<uint32_t>(l);
+            input[12][l] = lo;
+            input[13][l] = m_state[13] + (lo < m_state[12] ? 1 : 0);
+        }
+
+        uint32_t x[16][PRNG_BLOCKS];
+        std::memcpy(x, input, sizeof(x));
+        for (int round = 0; round < 10; round++)
+        {
+            QuarterRound(x, 0, 4, 8, 12);
+            QuarterRound(x, 1, 5, 9, 13);
+            QuarterRound(x, 2, 6, 10, 14);
+            QuarterRound(x, 3, 7, 11, 15);
+            QuarterRound(x, 0, 5, 10, 15);
+            QuarterRound(x, 1, 6, 11, 12);
+            QuarterRound(x, 2, 7, 8, 13);
+            QuarterRound(x, 3, 4, 9, 14);
+        }
+        for (size_t l = 0; l < PRNG_BLOCKS; l++)
+        {
+            for (size_t w = 0; w < 16; w++)
+            {
+                m_block[(l * 16) + w] = x[w][l] + input[w][l];
+            }
+        }
+
+        Seek(((static_cast<uint64_t>(m_state[13]) << 32) | m_state[12]) + PRNG_BLOCKS);
+        m_used = 0;
+    }
+
+    void ChaChaPrng::Seek(uint64_t block) noexcept
+    {
+        m_state[12] = static_cast<uint32_t>(block);
+        m_state[13] = static_cast<uint32_t>(block >> 32);
+        m_used = m_block.size();
+    }
+
+    ChaChaPrng::result_type ChaChaPrng::operator()()
+    {
+        if (m_used == m_block.size())
+        {
+            Refill();
+        }
+        return m_block[m_used++];
+    }
+
+    uint64_t ChaChaPrng::NextU64()
+    {
+        const uint64_t lo = (*this)();
+        return lo | (static_cast<uint64_t>((*this)()) << 32);
+    }
+
+    uint64_t ChaChaPrng::Uniform(uint64_t modulus)
+    {
+        if (modulus == 0)
+        {
+            throw std::runtime_error("modulus must be non-zero");
+        }
+
+        const uint64_t max = modulus - 1;
+        uint64_t mask = max;
+        mask |= mask >> 1;
+        mask |= mask >> 2;
+        mask |= mask >> 4;
+        mask |= mask >> 8;
+        mask |= mask >> 16;
+        mask |= mask >> 32;
+
+        // one word per try for moduli below 2^32
+        const bool wide = (mask >> 32) != 0;
+        uint64_t v;
+        do
+        {
+            v = (wide ? NextU64() : (*this)()) & mask;
+        } while (v > max);
+        return v;
+    }
+
+    void FillUniform(lbcrypto::DCRTPoly &poly, ChaChaPrng &prng)
+    {
+        const Format format = poly.GetFormat();
+        const size_t ringDim = poly.GetRingDimension();
+        auto &towers = poly.GetAllElements();
+        for (auto &tower : towers)
+        {
+            const lbcrypto::NativeInteger &q = tower.GetModulus();
+            const uint64_t modulus = q.ConvertToInt<uint64_t>();
+
+            lbcrypto::NativeVector values(ringDim, q);
+            for (size_t i = 0; i < ringDim; i++)
+            {
+                values[i] = lbcrypto::NativeInteger(prng.Uniform(modulus));
+            }
+            tower.SetValues(std::move(values), format);
+        }
+    }
+} // openfhe
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "openfhe/core/lattice/hal/lat-backend.h"
+#include "rust/cxx.h"
+
+namespace openfhe
+{
+
+    constexpr size_t PRNG_SEED_BYTES = 32;
+
+    // ChaCha20 keystream in Bernstein's original layout (64-bit block counter in state words
+    // 12-13, 64-bit stream id in 14-15; not the RFC 7539 32-bit counter / 96-bit nonce split)
+    // used as a deterministic PRG. The same (seed, stream) always yields the same words, and
+    // distinct streams under one seed are independent, so parallel work can be given a stream
+    // each and still be reproducible. Satisfies UniformRandomBitGenerator.
+    //
+    // Blocks are produced PRNG_BLOCKS at a time with the rounds written lane-wise, which the
+    // compiler turns into SIMD code on SSE2/AVX2/NEON without target-specific intrinsics.
+    constexpr size_t PRNG_BLOCKS = 4;
+
+    class ChaChaPrng final
+    {
+        std::array<uint32_t, 16> m_state;
+        std::array<uint32_t, 16 * PRNG_BLOCKS> m_block;
+        size_t m_used = 16 * PRNG_BLOCKS;
+
+        void Refill();
+
+    public:
+        using result_type = uint32_t;
+
+        // `seed` must hold PRNG_SEED_BYTES bytes.
+        ChaChaPrng(rust::Slice<const uint8_t> seed, uint64_t stream);
+
+        [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+        [[nodiscard]] static constexpr result_type max() noexcept { return UINT32_MAX; }
+        // Restarts the keystream at 64-byte block `block` of the stream.
+        void Seek(uint64_t block) noexcept;
+        result_type operator()();
+        [[nodiscard]] uint64_t NextU64();
+        // Uniform in [0, modulus) by rejection on the bit length of modulus
+        [[nodiscard]] uint64_t Uniform(uint64_t modulus);
+    };
+
+    // Overwrites every tower of `poly` with residues uniform mod the tower modulus, keeping its
+    // format; the towers are filled in order, each as n consecutive draws.
+    void FillUniform(lbcrypto::DCRTPoly &poly, ChaChaPrng &prng);
+} // openfhe
@@ -2,6 +2,7 @@
 
 #include "openfhe/pke/cryptocontext-ser.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "Ciphertext.h"
@@ -12,6 +13,68 @@
 namespace openfhe
 {
 
+RustVecStreambuf::RustVecStreambuf(rust::Vec<uint8_t>& bytes) noexcept
+    : m_bytes(bytes)
+{ }
+RustVecStreambuf::int_type RustVecStreambuf::overflow(int_type ch)
+{
+    if (traits_type::eq_int_type(ch, traits_type::eof()))
+    {
+        return traits_type::not_eof(ch);
+    }
+    m_bytes.push_back(static_cast<uint8_t>(traits_type::to_char_type(ch)));
+    return ch;
+}
+std::streamsize RustVecStreambuf::xsputn(const char* s, std::streamsize count)
+{
+    // rust::Vec has no bulk append; grow geometrically so the pushes stay in reserved capacity
+    const size_t needed = m_bytes.size() + static_cast<size_t>(count);
+    if (needed > m_bytes.capacity())
+    {
+        m_bytes.reserve(std::max(needed, 2 * m_bytes.capacity()));
+    }
+    for (std::streamsize i = 0; i < count; ++i)
+    {
+        m_bytes.push_back(static_cast<uint8_t>(s[i]));
+    }
+    return count;
+}
+
+SliceStreambuf::SliceStreambuf(rust::Slice<const uint8_t> data) noexcept
+{
+    // the get area is only ever read, so dropping const is safe
+    char* begin = const_cast<char*>(reinterpret_cast<const char*>(data.data()));
+    setg(begin, begin, begin + data.size());
+}
+SliceStreambuf::pos_type SliceStreambuf::seekoff(off_type off, std::ios_base::seekdir dir,
+    std::ios_base::openmode which)
+{
+    if (!(which & std::ios_base::in))
+    {
+        return pos_type(off_type(-1));
+    }
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+    {
+        base = gptr() - eback();
+    }
+    else if (dir == std::ios_base::end)
+    {
+        base = egptr() - eback();
+    }
+    const off_type target = base + off;
+    if (target < 0 || target > egptr() - eback())
+    {
+        return pos_type(off_type(-1));
+    }
+    setg(eback(), eback() + target, egptr());
+    return pos_type(target);
+}
+SliceStreambuf::pos_type SliceStreambuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
 template <typename ST, typename Object>
 [[nodiscard]] bool SerialDeserial(const std::string& location,
     bool (* const funcPtr) (const std::string&, Object&, const ST&), Object& object)
@@ -71,6 +134,16 @@ bool DCRTPolySerializeCiphertextToFile(const std::string& ciphertextLocation,
 {
     return Serial(ciphertextLocation, ciphertext, serialMode);
 }
+bool DCRTPolyDeserializeCiphertextFromBytes(rust::Slice<const uint8_t> data,
+    CiphertextDCRTPoly& ciphertext, const SerialMode serialMode)
+{
+    return DeserializeObjectFromBytes(data, ciphertext.GetRef(), serialMode);
+}
+rust::Vec<uint8_t> DCRTPolySerializeCiphertextToBytes(const CiphertextDCRTPoly& ciphertext,
+    const SerialMode serialMode)
+{
+    return SerializeObjectToBytes(ciphertext.GetRef(), serialMode);
+}
 
 // CryptoContext
 bool DCRTPolyDeserializeCryptoContextFromFile(const std::string& ccLocation,
@@ -83,6 +156,16 @@ bool DCRTPolySerializeCryptoContextToFile(const std::string& ccLocation,
 {
     return Serial(ccLocation, cryptoContext, serialMode);
 }
+bool DCRTPolyDeserializeCryptoContextFromBytes(rust::Slice<const uint8_t> data,
+    CryptoContextDCRTPoly& cryptoContext, const SerialMode serialMode)
+{
+    return DeserializeObjectFromBytes(data, cryptoContext.GetRef(), serialMode);
+}
+rust::Vec<uint8_t> DCRTPolySerializeCryptoContextToBytes(
+    const CryptoContextDCRTPoly& cryptoContext, const SerialMode serialMode)
+{
+    return SerializeObjectToBytes(cryptoContext.GetRef(), serialMode);
+}
 
 // EvalAutomorphismKey
 bool DCRTPolyDeserializeEvalAutomorphismKeyFromFile(const std::string& automorphismKeyLocation,
@@ -231,6 +314,24 @@ bool DCRTPolySerializeEvalSumKeyToFile(const std::string& sumKeyLocation,
     }
     return false;
 }
+bool DCRTPolyDeserializeEvalSumKeyFromBytes(rust::Slice<const uint8_t> data,
+    const SerialMode serialMode)
+{
+    return DeserializeFromBytes(data, serialMode, [](std::istream& is, const auto& serType)
+        { return CryptoContextImpl::DeserializeEvalAutomorphismKey(is, serType); });
+}
+rust::Vec<uint8_t> DCRTPolySerializeEvalSumKeyByIdToBytes(const SerialMode serialMode,
+    const std::string& id)
+{
+    return SerializeToBytes(serialMode, [&](std::ostream& os, const auto& serType)
+        { return CryptoContextImpl::SerializeEvalSumKey(os, serType, id); });
+}
+rust::Vec<uint8_t> DCRTPolySerializeEvalSumKeyToBytes(const CryptoContextDCRTPoly& cryptoContext,
+    const SerialMode serialMode)
+{
+    return SerializeToBytes(serialMode, [&](std::ostream& os, const auto& serType)
+        { return CryptoContextImpl::SerializeEvalAutomorphismKey(os, serType, cryptoContext.GetRef()); });
+}
 
 // PublicKey
 bool DCRTPolyDeserializePublicKeyFromFile(const std::string& publicKeyLocation,
@@ -243,6 +344,16 @@ bool DCRTPolySerializePublicKeyToFile(const std::string& publicKeyLocation,
 {
     return Serial(publicKeyLocation, publicKey, serialMode);
 }
+bool DCRTPolyDeserializePublicKeyFromBytes(rust::Slice<const uint8_t> data,
+    PublicKeyDCRTPoly& publicKey, const SerialMode serialMode)
+{
+    return DeserializeObjectFromBytes(data, publicKey.GetRef(), serialMode);
+}
+rust::Vec<uint8_t> DCRTPolySerializePublicKeyToBytes(const PublicKeyDCRTPoly& publicKey,
+    const SerialMode serialMode)
+{
+    return SerializeObjectToBytes(publicKey.GetRef(), serialMode);
+}
 
 bool DCRTPolyDeserializePrivateKeyFromFile(const std::string& privateKeyLocation,
     PrivateKeyDCRTPoly& privateKey, const SerialMode serialMode)
@@ -255,5 +366,15 @@ bool DCRTPolySerializePrivateKeyToFile(const std::string& privateKeyLocation,
 {
     return Serial(privateKeyLocation, privateKey, serialMode);
 }
+bool DCRTPolyDeserializePrivateKeyFromBytes(rust::Slice<const uint8_t> data,
+    PrivateKeyDCRTPoly& privateKey, const SerialMode serialMode)
+{
+    return DeserializeObjectFromBytes(data, privateKey.GetRef(), serialMode);
+}
+rust::Vec<uint8_t> DCRTPolySerializePrivateKeyToBytes(const PrivateKeyDCRTPoly& privateKey,
+    const SerialMode serialMode)
+{
+    return SerializeObjectToBytes(privateKey.GetRef(), serialMode);
+}
 
 } // openfhe
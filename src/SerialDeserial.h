@@ -2,11 +2,130 @@
 
 #include "SerialMode.h"
 
+#include "openfhe/core/utils/serial.h"
+
+#include "rust/cxx.h"
+
+#include <exception>
+#include <istream>
+#include <ostream>
+#include <streambuf>
 #include <string>
 
 namespace openfhe
 {
 
+// Output buffer that appends straight into a Rust-owned byte vector, so serialized bytes are
+// written once instead of going through an ostringstream and a std::string copy
+class RustVecStreambuf final : public std::streambuf
+{
+    rust::Vec<uint8_t>& m_bytes;
+
+public:
+    explicit RustVecStreambuf(rust::Vec<uint8_t>& bytes) noexcept;
+    RustVecStreambuf(const RustVecStreambuf&) = delete;
+    RustVecStreambuf(RustVecStreambuf&&) = delete;
+    RustVecStreambuf& operator=(const RustVecStreambuf&) = delete;
+    RustVecStreambuf& operator=(RustVecStreambuf&&) = delete;
+
+protected:
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char* s, std::streamsize count) override;
+};
+
+// Read-only buffer over a borrowed byte slice; nothing is copied before deserialization
+class SliceStreambuf final : public std::streambuf
+{
+public:
+    explicit SliceStreambuf(rust::Slice<const uint8_t> data) noexcept;
+    SliceStreambuf(const SliceStreambuf&) = delete;
+    SliceStreambuf(SliceStreambuf&&) = delete;
+    SliceStreambuf& operator=(const SliceStreambuf&) = delete;
+    SliceStreambuf& operator=(SliceStreambuf&&) = delete;
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+        std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+};
+
+template <typename Func>
+[[nodiscard]] bool DispatchBySerialMode(const SerialMode serialMode, Func&& func)
+{
+    if (serialMode == SerialMode::BINARY)
+    {
+        return func(lbcrypto::SerType::SERBINARY{});
+    }
+    if (serialMode == SerialMode::JSON)
+    {
+        return func(lbcrypto::SerType::SERJSON{});
+    }
+    return false;
+}
+
+// Runs func(std::ostream&, serType) with the stream writing into the returned vector, which is
+// left empty when func reports failure
+template <typename Func>
+[[nodiscard]] rust::Vec<uint8_t> SerializeToBytes(const SerialMode serialMode, Func&& func)
+{
+    rust::Vec<uint8_t> bytes;
+    RustVecStreambuf buf(bytes);
+    std::ostream stream(&buf);
+    if (!DispatchBySerialMode(serialMode, [&](const auto& serType)
+        { return func(stream, serType) && stream.good(); }))
+    {
+        bytes.clear();
+    }
+    return bytes;
+}
+// Runs func(std::istream&, serType) over `data` in place
+template <typename Func>
+[[nodiscard]] bool DeserializeFromBytes(rust::Slice<const uint8_t> data,
+    const SerialMode serialMode, Func&& func)
+{
+    SliceStreambuf buf(data);
+    std::istream stream(&buf);
+    return DispatchBySerialMode(serialMode, [&](const auto& serType)
+        { return func(stream, serType); });
+}
+
+// lbcrypto::Serial round trips of any serializable object; a malformed input reports false as
+// DeserializeFromFile does, and a failed serialization returns an empty vector
+template <typename Object>
+[[nodiscard]] rust::Vec<uint8_t> SerializeObjectToBytes(const Object& object,
+    const SerialMode serialMode)
+{
+    return SerializeToBytes(serialMode, [&](std::ostream& os, const auto& serType)
+    {
+        try
+        {
+            lbcrypto::Serial::Serialize(object, os, serType);
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+        return true;
+    });
+}
+template <typename Object>
+[[nodiscard]] bool DeserializeObjectFromBytes(rust::Slice<const uint8_t> data, Object& object,
+    const SerialMode serialMode)
+{
+    return DeserializeFromBytes(data, serialMode, [&](std::istream& is, const auto& serType)
+    {
+        try
+        {
+            lbcrypto::Serial::Deserialize(object, is, serType);
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+        return true;
+    });
+}
+
 class CiphertextDCRTPoly;
 class CryptoContextDCRTPoly;
 class PrivateKeyDCRTPoly;
@@ -18,11 +137,20 @@ class PublicKeyDCRTPoly;
 [[nodiscard]] bool DCRTPolySerializeCiphertextToFile(const std::string& ciphertextLocation,
     const CiphertextDCRTPoly& ciphertext, const SerialMode serialMode);
 
+[[nodiscard]] bool DCRTPolyDeserializeCiphertextFromBytes(rust::Slice<const uint8_t> data,
+    CiphertextDCRTPoly& ciphertext, const SerialMode serialMode);
+[[nodiscard]] rust::Vec<uint8_t> DCRTPolySerializeCiphertextToBytes(
+    const CiphertextDCRTPoly& ciphertext, const SerialMode serialMode);
+
 // CryptoContext
 [[nodiscard]] bool DCRTPolyDeserializeCryptoContextFromFile(const std::string& ccLocation,
     CryptoContextDCRTPoly& cryptoContext, const SerialMode serialMode);
 [[nodiscard]] bool DCRTPolySerializeCryptoContextToFile(const std::string& ccLocation,
     const CryptoContextDCRTPoly& cryptoContext, const SerialMode serialMode);
+[[nodiscard]] bool DCRTPolyDeserializeCryptoContextFromBytes(rust::Slice<const uint8_t> data,
+    CryptoContextDCRTPoly& cryptoContext, const SerialMode serialMode);
+[[nodiscard]] rust::Vec<uint8_t> DCRTPolySerializeCryptoContextToBytes(
+    const CryptoContextDCRTPoly& cryptoContext, const SerialMode serialMode);
 
 // EvalAutomorphismKey
 [[nodiscard]] bool DCRTPolyDeserializeEvalMultKeyFromFile(const std::string& multKeyLocation,
@@ -49,16 +177,30 @@ class PublicKeyDCRTPoly;
     const SerialMode serialMode, const std::string& id);
 [[nodiscard]] bool DCRTPolySerializeEvalSumKeyToFile(const std::string& sumKeyLocation,
     const CryptoContextDCRTPoly& cryptoContext, const SerialMode serialMode);
+[[nodiscard]] bool DCRTPolyDeserializeEvalSumKeyFromBytes(rust::Slice<const uint8_t> data,
+    const SerialMode serialMode);
+[[nodiscard]] rust::Vec<uint8_t> DCRTPolySerializeEvalSumKeyByIdToBytes(
+    const SerialMode serialMode, const std::string& id);
+[[nodiscard]] rust::Vec<uint8_t> DCRTPolySerializeEvalSumKeyToBytes(
+    const CryptoContextDCRTPoly& cryptoContext, const SerialMode serialMode);
 
 // PublicKey
 [[nodiscard]] bool DCRTPolyDeserializePublicKeyFromFile(const std::string& publicKeyLocation,
     PublicKeyDCRTPoly& publicKey, const SerialMode serialMode);
 [[nodiscard]] bool DCRTPolySerializePublicKeyToFile(const std::string& publicKeyLocation,
     const PublicKeyDCRTPoly& publicKey, const SerialMode serialMode);
+[[nodiscard]] bool DCRTPolyDeserializePublicKeyFromBytes(rust::Slice<const uint8_t> data,
+    PublicKeyDCRTPoly& publicKey, const SerialMode serialMode);
+[[nodiscard]] rust::Vec<uint8_t> DCRTPolySerializePublicKeyToBytes(
+    const PublicKeyDCRTPoly& publicKey, const SerialMode serialMode);
 
 [[nodiscard]] bool DCRTPolyDeserializePrivateKeyFromFile(const std::string& privateKeyLocation,
     PrivateKeyDCRTPoly& privateKey, const SerialMode serialMode);
 [[nodiscard]] bool DCRTPolySerializePrivateKeyToFile(const std::string& privateKeyLocation,
     const PrivateKeyDCRTPoly& cryptoContext, const SerialMode serialMode);
+[[nodiscard]] bool DCRTPolyDeserializePrivateKeyFromBytes(rust::Slice<const uint8_t> data,
+    PrivateKeyDCRTPoly& privateKey, const SerialMode serialMode);
+[[nodiscard]] rust::Vec<uint8_t> DCRTPolySerializePrivateKeyToBytes(
+    const PrivateKeyDCRTPoly& privateKey, const SerialMode serialMode);
 
 } // openfhe
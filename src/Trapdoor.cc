@@ -1,6 +1,16 @@
 #include "Trapdoor.h"
+#include "MatrixFile.h"
 #include "Params.h"
-#include <filesystem>
+#include "Prng.h"
+#include "SerialDeserial.h"
+#include "openfhe/src/lib.rs.h"
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <utility>
 #include <vector>
 
 namespace openfhe
@@ -32,6 +42,791 @@ namespace openfhe
         return std::make_unique<DCRTPoly>(std::move(copy));
     }
 
+    const Matrix &DCRTTrapdoor::GetPublicMatrixRef() const noexcept
+    {
+        return m_publicMatrix;
+    }
+
+    std::unique_ptr<DCRTPoly> DCRTTrapdoor::GetPublicMatrixElementRef(size_t row, size_t col) const
+    {
+        return GetMatrixElementRef(m_publicMatrix, row, col);
+    }
+
+    const RLWETrapdoorPair &DCRTTrapdoor::GetTrapdoorPairRef() const noexcept
+    {
+        return m_trapdoorPair;
+    }
+
+    std::unique_ptr<Matrix> DCRTTrapdoor::TakePublicMatrix()
+    {
+        return std::make_unique<Matrix>(std::move(m_publicMatrix));
+    }
+
+    std::unique_ptr<RLWETrapdoorPair> DCRTTrapdoor::TakeTrapdoorPair()
+    {
+        return std::make_unique<RLWETrapdoorPair>(std::move(m_trapdoorPair));
+    }
+
+    VectorOfDCRTTrapdoors::VectorOfDCRTTrapdoors(std::vector<std::unique_ptr<DCRTTrapdoor>> &&trapdoors) noexcept
+        : m_trapdoors(std::move(trapdoors))
+    {
+    }
+
+    size_t VectorOfDCRTTrapdoors::GetSize() const noexcept
+    {
+        return m_trapdoors.size();
+    }
+
+    const DCRTTrapdoor &VectorOfDCRTTrapdoors::GetElement(size_t index) const
+    {
+        if (index >= m_trapdoors.size() || !m_trapdoors[index])
+        {
+            throw std::out_of_range("trapdoor index out of range or already taken");
+        }
+        return *m_trapdoors[index];
+    }
+
+    std::unique_ptr<DCRTTrapdoor> VectorOfDCRTTrapdoors::TakeElement(size_t index)
+    {
+        if (index >= m_trapdoors.size() || !m_trapdoors[index])
+        {
+            throw std::out_of_range("trapdoor index out of range or already taken");
+        }
+        return std::move(m_trapdoors[index]);
+    }
+
+    namespace
+    {
+        // Nothing may unwind out of an OpenMP region. Loop bodies report into this instead: the
+        // first exception is kept, later iterations check Failed() and skip, and the owner
+        // rethrows once the region has ended.
+        class ParallelErrors final
+        {
+            std::exception_ptr m_error;
+            std::atomic<bool> m_failed{false};
+
+        public:
+            // Call from inside a catch block.
+            void Capture() noexcept
+            {
+#pragma omp critical(openfhe_trapdoor_parallel_error)
+                {
+                    if (!m_error)
+                    {
+                        m_error = std::current_exception();
+                    }
+                }
+                m_failed.store(true, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] bool Failed() const noexcept
+            {
+                return m_failed.load(std::memory_order_relaxed);
+            }
+
+            void RethrowIfFailed() const
+            {
+                if (m_error)
+                {
+                    std::rethrow_exception(m_error);
+                }
+            }
+        };
+
+        // body(i) for every i < count in parallel; the first exception is rethrown afterwards.
+        template <typename Body>
+        void ParallelFor(size_t count, Body body)
+        {
+            ParallelErrors errors;
+#pragma omp parallel for if (count > 1)
+            for (long iL = 0; iL < static_cast<long>(count); ++iL)
+            {
+                if (errors.Failed())
+                {
+                    continue;
+                }
+                try
+                {
+                    body(static_cast<size_t>(iL));
+                }
+                catch (...)
+                {
+                    errors.Capture();
+                }
+            }
+            errors.RethrowIfFailed();
+        }
+
+        // Sum over l of lhs(i, l) * rhs(j, l)^T on the first tower, lifted to FFT-domain field
+        // elements as -sigma^2 * (.) plus s^2 on the diagonal when `diagonal` is set.
+        lbcrypto::Matrix<lbcrypto::Field2n> PerturbationCovariance(
+            const Matrix &lhs,
+            const Matrix &rhs,
+            usint n,
+            double sigma,
+            double s,
+            bool diagonal)
+        {
+            const size_t d = lhs.GetRows();
+            const size_t cols = lhs.GetCols();
+            const auto &towerParams = lhs(0, 0).GetParams()->GetParams()[0];
+
+            lbcrypto::Matrix<lbcrypto::Field2n> result([&]()
+                                                       { return lbcrypto::Field2n(n, Format::EVALUATION, true); }, d, d);
+            for (size_t i = 0; i < d; i++)
+            {
+                for (size_t j = 0; j < d; j++)
+                {
+                    lbcrypto::NativePoly acc(towerParams, Format::EVALUATION, true);
+                    for (size_t l = 0; l < cols; l++)
+                    {
+                        acc += lhs(i, l).GetElementAtIndex(0) * rhs(j, l).GetElementAtIndex(0).Transpose();
+                    }
+                    acc.SetFormat(Format::COEFFICIENT);
+
+                    result(i, j) = lbcrypto::Field2n(acc).ScalarMult(-sigma * sigma);
+                    if (diagonal && i == j)
+                    {
+                        result(i, j) = result(i, j) + s * s;
+                    }
+                }
+            }
+
+            // converts the field elements to DFT representation
+            result.SetFormat(Format::EVALUATION);
+            return result;
+        }
+
+        // dst = scale * src as centred real coefficients, written over dst's existing slots rather
+        // than through a temporary Field2n. dst must be a COEFFICIENT-format element of src's ring.
+        void AssignScaledField2n(lbcrypto::Field2n &dst, const lbcrypto::DCRTPoly &src, double scale)
+        {
+            if (src.GetFormat() != Format::COEFFICIENT)
+            {
+                throw std::runtime_error("field conversion needs a COEFFICIENT-format poly");
+            }
+            if (dst.GetFormat() != Format::COEFFICIENT || dst.size() != src.GetRingDimension())
+            {
+                throw std::runtime_error("field element does not match the poly");
+            }
+
+            const lbcrypto::DCRTPoly::PolyLargeType large = src.CRTInterpolate();
+            const lbcrypto::BigInteger &q = large.GetModulus();
+            const lbcrypto::BigInteger half = q >> 1;
+            for (size_t i = 0; i < dst.size(); i++)
+            {
+                const lbcrypto::BigInteger &v = large[i];
+                dst[i] = scale * (v > half ? -(q - v).ConvertToDouble() : v.ConvertToDouble());
+            }
+        }
+    } // namespace
+
+    DCRTTrapdoorSampler::DCRTTrapdoorSampler(
+        std::shared_ptr<lbcrypto::DCRTPoly::Params> params,
+        const Matrix &publicMatrix,
+        const RLWETrapdoorPair &trapdoor,
+        bool square,
+        int64_t base,
+        double dggStddev)
+        : m_params(std::move(params)),
+          m_publicMatrix(publicMatrix),
+          m_tPrime(square ? trapdoor.m_r : trapdoor.m_e),
+          m_square(square),
+          m_n(m_params->GetRingDimension()),
+          m_d(trapdoor.m_r.GetRows()),
+          m_k(trapdoor.m_r.GetCols() / trapdoor.m_r.GetRows()),
+          m_base(base),
+          m_c((base + 1) * lbcrypto::SIGMA),
+          m_s(square ? lbcrypto::SPECTRAL_BOUND_D(m_n, m_k, base, m_d) : lbcrypto::SPECTRAL_BOUND(m_n, m_k, base)),
+          m_sigmaLarge(sqrt(m_s * m_s - m_c * m_c)),
+          m_dgg(dggStddev),
+          m_dggLargeSigma(m_sigmaLarge),
+          m_covA(PerturbationCovariance(m_tPrime, m_tPrime, m_n, m_c, m_s, true)),
+          m_covB(PerturbationCovariance(square ? trapdoor.m_e : trapdoor.m_r, m_tPrime, m_n, m_c, m_s, false)),
+          m_covD(PerturbationCovariance(square ? trapdoor.m_e : trapdoor.m_r, square ? trapdoor.m_e : trapdoor.m_r, m_n, m_c, m_s, true))
+    {
+        // m_tPrime held only its first row block while the covariances were built above
+        m_tPrime.VStack(square ? trapdoor.m_e : trapdoor.m_r);
+    }
+
+    Matrix DCRTTrapdoorSampler::SamplePerturbation(DggType &dgg, DggType &dggLargeSigma) const
+    {
+        const size_t dk = m_d * m_k;
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(m_params, Format::EVALUATION);
+
+        // p2: d * k x d ring elements with the large width
+        lbcrypto::Matrix<int64_t> p2ZVector([]()
+                                            { return 0; }, m_n * dk, m_d);
+        for (size_t j = 0; j < m_d; j++)
+        {
+            if (m_sigmaLarge > lbcrypto::KARNEY_THRESHOLD)
+            {
+                for (size_t i = 0; i < m_n * dk; i++)
+                {
+                    p2ZVector(i, j) = dgg.GenerateIntegerKarney(0, m_sigmaLarge);
+                }
+            }
+            else
+            {
+                std::shared_ptr<int64_t> dggVector = dggLargeSigma.GenerateIntVector(m_n * dk);
+                for (size_t i = 0; i < m_n * dk; i++)
+                {
+                    p2ZVector(i, j) = dggVector.get()[i];
+                }
+            }
+        }
+
+        Matrix p2(zero_alloc, dk, m_d);
+        for (size_t j = 0; j < m_d; j++)
+        {
+            Matrix col = lbcrypto::SplitInt64IntoElements<lbcrypto::DCRTPoly>(p2ZVector.ExtractCol(j), m_n, m_params);
+            for (size_t i = 0; i < dk; i++)
+            {
+                p2(i, j) = std::move(col(i, 0));
+            }
+        }
+        p2.SetFormat(Format::EVALUATION);
+
+        // p1: 2d x d elements with covariance s^2 I - sigma^2 T T^*, centered on the T p2 term
+        Matrix tp2 = m_tPrime * p2;
+        tp2.SetFormat(Format::COEFFICIENT);
+
+        const double cScale = -m_c * m_c / (m_s * m_s - m_c * m_c);
+        lbcrypto::Matrix<lbcrypto::Field2n> c([&]()
+                                              { return lbcrypto::Field2n(m_n, Format::COEFFICIENT); }, 2 * m_d, m_d);
+        for (size_t i = 0; i < 2 * m_d; i++)
+        {
+            for (size_t j = 0; j < m_d; j++)
+            {
+                c(i, j) = lbcrypto::Field2n(tp2(i, j)).ScalarMult(cScale);
+            }
+        }
+
+        auto p1ZVector = std::make_shared<lbcrypto::Matrix<int64_t>>([]()
+                                                                     { return 0; }, m_n * 2 * m_d, m_d);
+        if (m_square)
+        {
+            lbcrypto::LatticeGaussSampUtility<lbcrypto::DCRTPoly>::SampleMat(m_covA, m_covB, m_covD, c, dgg, p1ZVector);
+        }
+        else
+        {
+            lbcrypto::LatticeGaussSampUtility<lbcrypto::DCRTPoly>::ZSampleSigma2x2(
+                m_covA(0, 0), m_covB(0, 0), m_covD(0, 0), c, dgg, p1ZVector);
+        }
+
+        Matrix pHat(zero_alloc, m_d * (m_k + 2), m_d);
+        for (size_t j = 0; j < m_d; j++)
+        {
+            Matrix p1 = lbcrypto::SplitInt64IntoElements<lbcrypto::DCRTPoly>(p1ZVector->ExtractCol(j), m_n, m_params);
+            p1.SetFormat(Format::EVALUATION);
+            for (size_t i = 0; i < 2 * m_d; i++)
+            {
+                pHat(i, j) = std::move(p1(i, 0));
+            }
+            for (size_t i = 0; i < dk; i++)
+            {
+                pHat(2 * m_d + i, j) = std::move(p2(i, j));
+            }
+        }
+        return pHat;
+    }
+
+    Matrix DCRTTrapdoorSampler::SampleWithPerturbation(const Matrix &U, const Matrix &pHat, DggType &dgg) const
+    {
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(m_params, Format::EVALUATION);
+        Matrix result(zero_alloc, m_d * (m_k + 2), m_d);
+        for (size_t j = 0; j < m_d; j++)
+        {
+            Matrix column = SampleColumnWithPerturbation(U, pHat, j, dgg);
+            for (size_t i = 0; i < m_d * (m_k + 2); i++)
+            {
+                result(i, j) = std::move(column(i, 0));
+            }
+        }
+        return result;
+    }
+
+    Matrix DCRTTrapdoorSampler::SampleColumnWithPerturbation(const Matrix &U, const Matrix &pHat, size_t col, DggType &dgg) const
+    {
+        if (U.GetRows() != m_d || U.GetCols() != m_d)
+        {
+            throw std::runtime_error("syndrome shape does not match the trapdoor");
+        }
+        if (col >= m_d)
+        {
+            throw std::out_of_range("syndrome column out of range");
+        }
+
+        const size_t size = m_params->GetParams().size();
+        const size_t kRes = m_k / size;
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(m_params, Format::EVALUATION);
+
+        const Matrix pHatCol = pHat.ExtractCol(col);
+        Matrix perturbedSyndrome = U.ExtractCol(col) - m_publicMatrix * pHatCol;
+
+        // G-lattice step, tower by tower, on every syndrome entry of the column
+        Matrix zHatMat(zero_alloc, m_d * m_k, 1);
+        lbcrypto::Matrix<int64_t> zHatBBI([]()
+                                          { return 0; }, m_k, m_n);
+        lbcrypto::Matrix<int64_t> digits([]()
+                                         { return 0; }, kRes, m_n);
+        for (size_t i = 0; i < m_d; i++)
+        {
+            perturbedSyndrome(i, 0).SetFormat(Format::COEFFICIENT);
+            for (size_t t = 0; t < size; t++)
+            {
+                const lbcrypto::NativeInteger &qt = m_params->GetParams()[t]->GetModulus();
+                lbcrypto::LatticeGaussSampUtility<lbcrypto::NativePoly>::GaussSampGqArbBase(
+                    perturbedSyndrome(i, 0).GetElementAtIndex(t), m_c, kRes, qt, m_base, dgg, &digits);
+                for (size_t p = 0; p < kRes; p++)
+                {
+                    for (size_t x = 0; x < m_n; x++)
+                    {
+                        zHatBBI(p + t * kRes, x) = digits(p, x);
+                    }
+                }
+            }
+
+            Matrix zHat = lbcrypto::SplitInt64AltIntoElements<lbcrypto::DCRTPoly>(zHatBBI, m_n, m_params);
+            zHat.SetFormat(Format::EVALUATION);
+            for (size_t p = 0; p < m_k; p++)
+            {
+                zHatMat(i * m_k + p, 0) = std::move(zHat(p, 0));
+            }
+        }
+
+        Matrix tZHat = m_tPrime * zHatMat;
+        Matrix result(zero_alloc, m_d * (m_k + 2), 1);
+        for (size_t i = 0; i < 2 * m_d; i++)
+        {
+            result(i, 0) = pHatCol(i, 0) + tZHat(i, 0);
+        }
+        for (size_t i = 0; i < m_d * m_k; i++)
+        {
+            result(2 * m_d + i, 0) = pHatCol(2 * m_d + i, 0) + zHatMat(i, 0);
+        }
+        return result;
+    }
+
+    std::unique_ptr<Matrix> DCRTTrapdoorSampler::Sample(const DCRTPoly &u)
+    {
+        if (m_square)
+        {
+            throw std::runtime_error("sampler was built for a square-matrix trapdoor");
+        }
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(m_params, Format::EVALUATION);
+        Matrix U(zero_alloc, 1, 1);
+        U(0, 0) = u.GetPoly();
+
+        Matrix pHat = SamplePerturbation(m_dgg, m_dggLargeSigma);
+        return std::make_unique<Matrix>(SampleWithPerturbation(U, pHat, m_dgg));
+    }
+
+    std::unique_ptr<Matrix> DCRTTrapdoorSampler::SampleSquareMat(const Matrix &U)
+    {
+        if (!m_square)
+        {
+            throw std::runtime_error("sampler was built for a 1 x (k + 2) trapdoor");
+        }
+        Matrix pHat = SamplePerturbation(m_dgg, m_dggLargeSigma);
+        return std::make_unique<Matrix>(SampleWithPerturbation(U, pHat, m_dgg));
+    }
+
+    const DCRTTrapdoorSampler::DggType &DCRTTrapdoorSampler::GetDgg() const noexcept
+    {
+        return m_dgg;
+    }
+
+    const DCRTTrapdoorSampler::DggType &DCRTTrapdoorSampler::GetDggLargeSigma() const noexcept
+    {
+        return m_dggLargeSigma;
+    }
+
+    bool DCRTTrapdoorSampler::IsSquare() const noexcept
+    {
+        return m_square;
+    }
+
+    usint DCRTTrapdoorSampler::GetRingDimension() const noexcept
+    {
+        return m_n;
+    }
+
+    size_t DCRTTrapdoorSampler::GetK() const noexcept
+    {
+        return m_k;
+    }
+
+    std::unique_ptr<DCRTTrapdoorSampler> DCRTTrapdoorSamplerGen(
+        usint n,
+        size_t size,
+        size_t kRes,
+        const Matrix &publicMatrix,
+        const RLWETrapdoorPair &trapdoor,
+        int64_t base,
+        double dggStddev)
+    {
+        return std::make_unique<DCRTTrapdoorSampler>(
+            GetDCRTPolyParams(n, size, kRes), publicMatrix, trapdoor, false, base, dggStddev);
+    }
+
+    std::unique_ptr<DCRTTrapdoorSampler> DCRTSquareMatTrapdoorSamplerGen(
+        usint n,
+        size_t size,
+        size_t kRes,
+        const Matrix &publicMatrix,
+        const RLWETrapdoorPair &trapdoor,
+        int64_t base,
+        double dggStddev)
+    {
+        return std::make_unique<DCRTTrapdoorSampler>(
+            GetDCRTPolyParams(n, size, kRes), publicMatrix, trapdoor, true, base, dggStddev);
+    }
+
+    DCRTPerturbationPool::DCRTPerturbationPool(
+        std::shared_ptr<lbcrypto::DCRTPoly::Params> params,
+        const Matrix &publicMatrix,
+        const RLWETrapdoorPair &trapdoor,
+        bool square,
+        int64_t base,
+        double dggStddev,
+        size_t capacity,
+        size_t workers)
+        : m_sampler(std::move(params), publicMatrix, trapdoor, square, base, dggStddev),
+          m_capacity(capacity),
+          m_dgg(m_sampler.GetDgg()),
+          m_dggLargeSigma(m_sampler.GetDggLargeSigma())
+    {
+        try
+        {
+            m_workers.reserve(workers);
+            for (size_t i = 0; i < workers; ++i)
+            {
+                m_workers.emplace_back([this]()
+                                       { Fill(); });
+            }
+        }
+        catch (...)
+        {
+            // The destructor will not run; joinable threads left behind would terminate
+            StopWorkers();
+            throw;
+        }
+    }
+
+    DCRTPerturbationPool::~DCRTPerturbationPool()
+    {
+        StopWorkers();
+    }
+
+    void DCRTPerturbationPool::StopWorkers() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_notFull.notify_all();
+        for (std::thread &worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    void DCRTPerturbationPool::Fill()
+    {
+        lbcrypto::DCRTPoly::DggType dgg = m_sampler.GetDgg();
+        lbcrypto::DCRTPoly::DggType dggLargeSigma = m_sampler.GetDggLargeSigma();
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_notFull.wait(lock, [this]()
+                               { return m_stop || m_pool.size() < m_capacity; });
+                if (m_stop)
+                {
+                    return;
+                }
+            }
+
+            try
+            {
+                // Drawn outside the lock; the pool may briefly overshoot by one per worker
+                Matrix pHat = m_sampler.SamplePerturbation(dgg, dggLargeSigma);
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_stop)
+                {
+                    return;
+                }
+                m_pool.push_back(std::move(pHat));
+            }
+            catch (...)
+            {
+                // Nothing may leave a std::thread by throwing; the online path still samples inline
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_workerError)
+                {
+                    m_workerError = std::current_exception();
+                }
+                return;
+            }
+        }
+    }
+
+    Matrix DCRTPerturbationPool::TakePerturbation()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_workerError)
+            {
+                std::exception_ptr error = std::exchange(m_workerError, nullptr);
+                std::rethrow_exception(error);
+            }
+            if (!m_pool.empty())
+            {
+                Matrix pHat = std::move(m_pool.front());
+                m_pool.pop_front();
+                m_notFull.notify_one();
+                return pHat;
+            }
+        }
+        return m_sampler.SamplePerturbation(m_dgg, m_dggLargeSigma);
+    }
+
+    std::unique_ptr<Matrix> DCRTPerturbationPool::Sample(const DCRTPoly &u)
+    {
+        if (m_sampler.IsSquare())
+        {
+            throw std::runtime_error("pool was built for a square-matrix trapdoor");
+        }
+        Matrix U(lbcrypto::DCRTPoly::Allocator(u.GetPoly().GetParams(), Format::EVALUATION), 1, 1);
+        U(0, 0) = u.GetPoly();
+
+        Matrix pHat = TakePerturbation();
+        return std::make_unique<Matrix>(m_sampler.SampleWithPerturbation(U, pHat, m_dgg));
+    }
+
+    std::unique_ptr<Matrix> DCRTPerturbationPool::SampleSquareMat(const Matrix &U)
+    {
+        if (!m_sampler.IsSquare())
+        {
+            throw std::runtime_error("pool was built for a 1 x (k + 2) trapdoor");
+        }
+        Matrix pHat = TakePerturbation();
+        return std::make_unique<Matrix>(m_sampler.SampleWithPerturbation(U, pHat, m_dgg));
+    }
+
+    size_t DCRTPerturbationPool::GetAvailable() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pool.size();
+    }
+
+    std::unique_ptr<DCRTPerturbationPool> DCRTPerturbationPoolGen(
+        usint n,
+        size_t size,
+        size_t kRes,
+        const Matrix &publicMatrix,
+        const RLWETrapdoorPair &trapdoor,
+        bool square,
+        int64_t base,
+        double dggStddev,
+        size_t capacity,
+        size_t workers)
+    {
+        return std::make_unique<DCRTPerturbationPool>(
+            GetDCRTPolyParams(n, size, kRes), publicMatrix, trapdoor, square, base, dggStddev, capacity, workers);
+    }
+
+    namespace
+    {
+        // Probability mass beyond 12 sigma is below 2^-100
+        constexpr double kCDTTailCut = 12.0;
+        // Keeps the table under a few MB; wider distributions should use Karney
+        constexpr double kCDTMaxStd = 65536.0;
+        // floor(ln 2 * 2^64)
+        constexpr uint64_t kLn2Q64 = 0xB17217F7D1CF79ABULL;
+
+        using uint128 = unsigned __int128;
+
+        // Seeded trapdoors must expand identically everywhere, so the table is built from IEEE
+        // double division (exactly rounded) and integer arithmetic only; no libm and no long double.
+        static_assert(FLT_EVAL_METHOD == 0, "CDT tables need double arithmetic without excess precision");
+
+        // exp(-t) for t >= 0 as a 64-bit binary fraction (2^64 stands for 1.0)
+        uint128 ExpNegQ64(double t)
+        {
+            // exp(-64) is far below 2^-64
+            if (t >= 64.0)
+            {
+                return 0;
+            }
+
+            // t as an exact fixed-point value with 64 fractional bits, at most 70 bits wide
+            int exponent = 0;
+            const double fraction = std::frexp(t, &exponent);
+            const auto mantissa = static_cast<uint64_t>(std::ldexp(fraction, 53));
+            const int shift = 64 + exponent - 53;
+            uint128 fixed = 0;
+            if (t > 0.0)
+            {
+                fixed = shift >= 0 ? uint128(mantissa) << shift : (shift > -64 ? uint128(mantissa >> -shift) : 0);
+            }
+
+            // t = halvings * ln 2 + r with 0 <= r < ln 2
+            const uint128 halvings = fixed / kLn2Q64;
+            const uint64_t r = static_cast<uint64_t>(fixed - (halvings * kLn2Q64));
+
+            // Alternating Taylor series of exp(-r); terms shrink below 2^-64 after about 20 steps
+            uint128 sum = uint128(1) << 64;
+            uint128 term = uint128(1) << 64;
+            for (uint64_t i = 1; term != 0; i++)
+            {
+                term = ((term * r) >> 64) / i;
+                sum = (i % 2 == 1) ? sum - term : sum + term;
+            }
+            return sum >> static_cast<unsigned>(halvings);
+        }
+
+        // floor(num * 2^63 / den) for num <= den, by binary long division
+        uint64_t ScaledRatio63(uint128 num, uint128 den)
+        {
+            uint64_t quotient = num >= den ? 1 : 0;
+            uint128 remainder = num >= den ? num - den : num;
+            for (int bit = 0; bit < 63; bit++)
+            {
+                remainder <<= 1;
+                quotient <<= 1;
+                if (remainder >= den)
+                {
+                    remainder -= den;
+                    quotient |= 1;
+                }
+            }
+            return quotient;
+        }
+    } // namespace
+
+    DiscreteGaussianCDT::DiscreteGaussianCDT(double stddev)
+        : m_std(stddev)
+    {
+        if (!(stddev > 0.0) || stddev > kCDTMaxStd)
+        {
+            throw std::runtime_error("CDT standard deviation must be in (0, 65536]");
+        }
+
+        const size_t tail = static_cast<size_t>(std::ceil(kCDTTailCut * stddev));
+        const double twoVariance = 2.0 * stddev * stddev;
+
+        // unnormalised mass of |x| = k as a 64-bit binary fraction; both signs count for k > 0.
+        // k^2 < 2^53 is exact in a double.
+        std::vector<uint128> mass(tail + 1);
+        uint128 total = 0;
+        for (size_t k = 0; k <= tail; k++)
+        {
+            const double t = static_cast<double>(static_cast<uint64_t>(k) * k) / twoVariance;
+            mass[k] = ExpNegQ64(t) * (k == 0 ? 1 : 2);
+            total += mass[k];
+        }
+
+        const uint64_t one = uint64_t(1) << 63;
+        m_cdf.resize(tail + 1);
+        uint128 acc = 0;
+        for (size_t k = 0; k <= tail; k++)
+        {
+            acc += mass[k];
+            m_cdf[k] = std::min(ScaledRatio63(acc, total), one);
+        }
+        m_cdf.back() = one;
+    }
+
+    double DiscreteGaussianCDT::GetStd() const noexcept
+    {
+        return m_std;
+    }
+
+    void DiscreteGaussianCDT::SampleInto(rust::Slice<int64_t> out) const
+    {
+        const size_t count = out.size();
+        int64_t *dst = out.data();
+
+#pragma omp parallel if (count > 4096)
+        {
+            // thread-local stream
+            auto &prng = lbcrypto::PseudoRandomNumberGenerator::GetPRNG();
+
+#pragma omp for schedule(static)
+            for (long iL = 0; iL < static_cast<long>(count); iL++)
+            {
+                dst[static_cast<size_t>(iL)] = Sample(prng);
+            }
+        }
+    }
+
+    std::unique_ptr<DCRTPoly> DiscreteGaussianCDT::SamplePoly(usint n, size_t size, size_t kRes) const
+    {
+        auto params = GetDCRTPolyParams(n, size, kRes);
+
+        std::vector<int64_t> samples(n);
+        SampleInto(rust::Slice<int64_t>(samples.data(), samples.size()));
+        // |x| <= 12 * 65536 stays below every tower modulus
+        return std::make_unique<DCRTPoly>(DCRTPolyFromSmallIntegers(
+            params, Format::EVALUATION, rust::Slice<const int64_t>(samples.data(), samples.size())));
+    }
+
+    std::unique_ptr<DiscreteGaussianCDT> DiscreteGaussianCDTGen(double stddev)
+    {
+        return std::make_unique<DiscreteGaussianCDT>(stddev);
+    }
+
+    namespace
+    {
+        // cereal view over the two matrices of a trapdoor pair, so they share one archive
+        // without being copied
+        struct TrapdoorPairArchive
+        {
+            Matrix &r;
+            Matrix &e;
+
+            template <class Archive>
+            void serialize(Archive &ar)
+            {
+                ar(::cereal::make_nvp("r", r), ::cereal::make_nvp("e", e));
+            }
+        };
+    } // namespace
+
+    rust::Vec<uint8_t> RLWETrapdoorPairSerializeToBytes(
+        const RLWETrapdoorPair &trapdoorPair,
+        const SerialMode serialMode)
+    {
+        // only read while saving
+        const TrapdoorPairArchive archive{const_cast<Matrix &>(trapdoorPair.m_r),
+                                          const_cast<Matrix &>(trapdoorPair.m_e)};
+        return SerializeObjectToBytes(archive, serialMode);
+    }
+
+    std::unique_ptr<RLWETrapdoorPair> RLWETrapdoorPairDeserializeFromBytes(
+        usint n,
+        size_t size,
+        size_t kRes,
+        rust::Slice<const uint8_t> data,
+        const SerialMode serialMode)
+    {
+        auto params = GetDCRTPolyParams(n, size, kRes);
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(params, Format::EVALUATION);
+
+        auto trapdoorPair = std::make_unique<RLWETrapdoorPair>(Matrix(zero_alloc, 0, 0), Matrix(zero_alloc, 0, 0));
+        TrapdoorPairArchive archive{trapdoorPair->m_r, trapdoorPair->m_e};
+        if (!DeserializeObjectFromBytes(data, archive, serialMode))
+        {
+            return nullptr;
+        }
+        trapdoorPair->m_r.SetAllocator(zero_alloc);
+        trapdoorPair->m_e.SetAllocator(zero_alloc);
+        return trapdoorPair;
+    }
+
     // Generator functions
     std::unique_ptr<DCRTTrapdoor> DCRTTrapdoorGen(
         usint n,
@@ -41,7 +836,7 @@ namespace openfhe
         int64_t base,
         bool balanced)
     {
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+        auto params = GetDCRTPolyParams(n, size, kRes);
 
         auto trapdoor = lbcrypto::RLWETrapdoorUtility<lbcrypto::DCRTPoly>::TrapdoorGen(
             params,
@@ -63,7 +858,7 @@ namespace openfhe
         int64_t base,
         bool balanced)
     {
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+        auto params = GetDCRTPolyParams(n, size, kRes);
 
         auto trapdoor = lbcrypto::RLWETrapdoorUtility<lbcrypto::DCRTPoly>::TrapdoorGenSquareMat(
             params,
@@ -77,6 +872,210 @@ namespace openfhe
             std::move(trapdoor.second));
     }
 
+    namespace
+    {
+        // log(base) below is only a positive, finite divisor for base >= 2
+        void CheckTrapdoorBase(int64_t base)
+        {
+            if (base < 2)
+            {
+                throw std::runtime_error("trapdoor gadget base must be at least 2");
+            }
+        }
+
+        // Gadget length per row, derived from the composite modulus as OpenFHE's TrapdoorGen does
+        size_t TrapdoorGadgetLength(const lbcrypto::DCRTPoly::Params &params, int64_t base, bool balanced)
+        {
+            CheckTrapdoorBase(base);
+            const double val = params.GetModulus().ConvertToDouble();
+            size_t k = static_cast<size_t>(std::floor(std::log(val - 1.0) / std::log(static_cast<double>(base)) + 1.0));
+            if (balanced)
+            {
+                // a balanced digit representation needs one extra digit
+                k++;
+            }
+            return k;
+        }
+
+        // Trapdoor (R, E) with Abar, R and E drawn in that order, row-major.
+        // Same layouts as OpenFHE, which the samplers rely on: [1, a, g - (a r + e)] for the
+        // 1-row trapdoor, [Abar | I | G - (Abar R + E)] for the square one.
+        std::unique_ptr<DCRTTrapdoor> SeededTrapdoorGen(
+            const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params,
+            bool square,
+            size_t d,
+            const DiscreteGaussianCDT &cdt,
+            int64_t base,
+            bool balanced,
+            ChaChaPrng &prng)
+        {
+            const size_t n = params->GetRingDimension();
+            const size_t k = TrapdoorGadgetLength(*params, base, balanced);
+            auto zero_alloc = lbcrypto::DCRTPoly::Allocator(params, Format::EVALUATION);
+
+            Matrix aBar(zero_alloc, d, d);
+            for (size_t i = 0; i < d; i++)
+            {
+                for (size_t j = 0; j < d; j++)
+                {
+                    FillUniform(aBar(i, j), prng);
+                }
+            }
+
+            std::vector<int64_t> coeffs(n);
+            auto gaussian = [&]()
+            {
+                for (auto &x : coeffs)
+                {
+                    x = cdt.Sample(prng);
+                }
+                return DCRTPolyFromSmallIntegers(
+                    params, Format::EVALUATION, rust::Slice<const int64_t>(coeffs.data(), coeffs.size()));
+            };
+
+            Matrix r(zero_alloc, d, d * k);
+            Matrix e(zero_alloc, d, d * k);
+            for (Matrix *m : {&r, &e})
+            {
+                for (size_t i = 0; i < d; i++)
+                {
+                    for (size_t j = 0; j < d * k; j++)
+                    {
+                        (*m)(i, j) = gaussian();
+                    }
+                }
+            }
+
+            Matrix g = Matrix(zero_alloc, 1, k).GadgetVector(base);
+            Matrix aRE = aBar * r + e;
+
+            const size_t aBarOffset = square ? 0 : d;
+            const size_t identityOffset = square ? d : 0;
+            Matrix A(zero_alloc, d, d * (k + 2));
+            for (size_t i = 0; i < d; i++)
+            {
+                A(i, identityOffset + i) = 1;
+                for (size_t j = 0; j < d; j++)
+                {
+                    A(i, aBarOffset + j) = aBar(i, j);
+                }
+                for (size_t l = 0; l < d * k; l++)
+                {
+                    A(i, 2 * d + l) = (l / k == i) ? g(0, l % k) - aRE(i, l) : aRE(i, l).Negate();
+                }
+            }
+
+            return std::make_unique<DCRTTrapdoor>(std::move(A), RLWETrapdoorPair(r, e));
+        }
+
+        std::unique_ptr<VectorOfDCRTTrapdoors> TrapdoorGenBatch(
+            const std::shared_ptr<lbcrypto::DCRTPoly::Params> &params,
+            bool square,
+            size_t d,
+            double stddev,
+            int64_t base,
+            bool balanced,
+            size_t count,
+            rust::Slice<const uint8_t> seed,
+            uint64_t firstStream)
+        {
+            // checked before anything is sampled; failures inside the loop are rethrown after it
+            CheckTrapdoorBase(base);
+            std::unique_ptr<DiscreteGaussianCDT> cdt;
+            if (!seed.empty())
+            {
+                if (seed.size() != PRNG_SEED_BYTES)
+                {
+                    throw std::runtime_error("PRNG seed must be 32 bytes");
+                }
+                cdt = std::make_unique<DiscreteGaussianCDT>(stddev);
+            }
+
+            std::vector<std::unique_ptr<DCRTTrapdoor>> trapdoors(count);
+            ParallelFor(
+                count,
+                [&](size_t i)
+                {
+                    if (cdt)
+                    {
+                        ChaChaPrng prng(seed, firstStream + i);
+                        trapdoors[i] = SeededTrapdoorGen(params, square, d, *cdt, base, balanced, prng);
+                        return;
+                    }
+
+                    auto trapdoor = square
+                                        ? lbcrypto::RLWETrapdoorUtility<lbcrypto::DCRTPoly>::TrapdoorGenSquareMat(params, stddev, d, base, balanced)
+                                        : lbcrypto::RLWETrapdoorUtility<lbcrypto::DCRTPoly>::TrapdoorGen(params, stddev, base, balanced);
+                    trapdoors[i] = std::make_unique<DCRTTrapdoor>(std::move(trapdoor.first), std::move(trapdoor.second));
+                });
+            return std::make_unique<VectorOfDCRTTrapdoors>(std::move(trapdoors));
+        }
+    } // namespace
+
+    std::unique_ptr<DCRTTrapdoor> DCRTTrapdoorGenSeeded(
+        usint n,
+        size_t size,
+        size_t kRes,
+        double stddev,
+        int64_t base,
+        bool balanced,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream)
+    {
+        CheckTrapdoorBase(base);
+        const DiscreteGaussianCDT cdt(stddev);
+        ChaChaPrng prng(seed, stream);
+        return SeededTrapdoorGen(GetDCRTPolyParams(n, size, kRes), false, 1, cdt, base, balanced, prng);
+    }
+
+    std::unique_ptr<DCRTTrapdoor> DCRTSquareMatTrapdoorGenSeeded(
+        usint n,
+        size_t size,
+        size_t kRes,
+        size_t d,
+        double stddev,
+        int64_t base,
+        bool balanced,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream)
+    {
+        CheckTrapdoorBase(base);
+        const DiscreteGaussianCDT cdt(stddev);
+        ChaChaPrng prng(seed, stream);
+        return SeededTrapdoorGen(GetDCRTPolyParams(n, size, kRes), true, d, cdt, base, balanced, prng);
+    }
+
+    std::unique_ptr<VectorOfDCRTTrapdoors> DCRTTrapdoorGenBatch(
+        usint n,
+        size_t size,
+        size_t kRes,
+        double stddev,
+        int64_t base,
+        bool balanced,
+        size_t count,
+        rust::Slice<const uint8_t> seed,
+        uint64_t firstStream)
+    {
+        return TrapdoorGenBatch(
+            GetDCRTPolyParams(n, size, kRes), false, 1, stddev, base, balanced, count, seed, firstStream);
+    }
+
+    std::unique_ptr<VectorOfDCRTTrapdoors> DCRTSquareMatTrapdoorGenBatch(
+        usint n,
+        size_t size,
+        size_t kRes,
+        size_t d,
+        double stddev,
+        int64_t base,
+        bool balanced,
+        size_t count,
+        rust::Slice<const uint8_t> seed,
+        uint64_t firstStream)
+    {
+        return TrapdoorGenBatch(
+            GetDCRTPolyParams(n, size, kRes), true, d, stddev, base, balanced, count, seed, firstStream);
+    }
+
     // Gauss sample functions
     std::unique_ptr<Matrix> DCRTTrapdoorGaussSamp(usint n, usint k, const Matrix &publicMatrix, const RLWETrapdoorPair &trapdoor, const DCRTPoly &u, int64_t base, double dggStddev)
     {
@@ -99,6 +1098,119 @@ namespace openfhe
         return std::make_unique<Matrix>(std::move(result));
     }
 
+    namespace
+    {
+        // Runs body(j, dgg, dggLargeSigma) for every j < count in parallel, with one pair of
+        // samplers per thread instead of per column. Errors are reported through ParallelErrors.
+        template <typename Body>
+        void ForEachColumn(const DCRTTrapdoorSampler &sampler, size_t count, Body body)
+        {
+            using DggType = lbcrypto::DCRTPoly::DggType;
+            ParallelErrors errors;
+
+#pragma omp parallel if (count > 1)
+            {
+                std::unique_ptr<DggType> dgg;
+                std::unique_ptr<DggType> dggLargeSigma;
+                try
+                {
+                    dgg = std::make_unique<DggType>(sampler.GetDgg());
+                    dggLargeSigma = std::make_unique<DggType>(sampler.GetDggLargeSigma());
+                }
+                catch (...)
+                {
+                    errors.Capture();
+                }
+
+#pragma omp for schedule(dynamic)
+                for (long jL = 0; jL < static_cast<long>(count); ++jL)
+                {
+                    if (errors.Failed())
+                    {
+                        continue;
+                    }
+                    try
+                    {
+                        body(static_cast<size_t>(jL), *dgg, *dggLargeSigma);
+                    }
+                    catch (...)
+                    {
+                        errors.Capture();
+                    }
+                }
+            }
+
+            errors.RethrowIfFailed();
+        }
+
+        // Samples one preimage per syndrome column in parallel and hands each to `sink(j, preimage)`
+        // as soon as it is ready, so callers decide whether columns are kept or streamed out.
+        template <typename Sink>
+        void GaussSampColumns(usint n, usint k, const Matrix &publicMatrix, const RLWETrapdoorPair &trapdoor, const Matrix &syndromes, int64_t base, double dggStddev, Sink sink)
+        {
+            if (syndromes.GetRows() != 1)
+            {
+                throw std::runtime_error("syndromes must be a single row of polys");
+            }
+
+            // Shared across every column: the covariance, spectral bound and sampler widths
+            const DCRTTrapdoorSampler sampler(publicMatrix(0, 0).GetParams(), publicMatrix, trapdoor, false, base, dggStddev);
+            if (sampler.GetRingDimension() != n || sampler.GetK() != k)
+            {
+                throw std::runtime_error("n and k do not match the trapdoor");
+            }
+
+            auto zero_alloc = lbcrypto::DCRTPoly::Allocator(publicMatrix(0, 0).GetParams(), Format::EVALUATION);
+            ForEachColumn(
+                sampler, syndromes.GetCols(),
+                [&](size_t j, lbcrypto::DCRTPoly::DggType &dgg, lbcrypto::DCRTPoly::DggType &dggLargeSigma)
+                {
+                    Matrix syndrome(zero_alloc, 1, 1);
+                    syndrome(0, 0) = syndromes(0, j);
+                    Matrix pHat = sampler.SamplePerturbation(dgg, dggLargeSigma);
+                    sink(j, sampler.SampleWithPerturbation(syndrome, pHat, dgg));
+                });
+        }
+    } // namespace
+
+    std::unique_ptr<Matrix> DCRTTrapdoorGaussSampBatch(usint n, usint k, const Matrix &publicMatrix, const RLWETrapdoorPair &trapdoor, const Matrix &syndromes, int64_t base, double dggStddev)
+    {
+        const size_t m = publicMatrix.GetCols();
+        auto zero_alloc = lbcrypto::DCRTPoly::Allocator(publicMatrix(0, 0).GetParams(), Format::EVALUATION);
+        auto result = std::make_unique<Matrix>(zero_alloc, m, syndromes.GetCols());
+
+        GaussSampColumns(
+            n, k, publicMatrix, trapdoor, syndromes, base, dggStddev,
+            [&](size_t j, Matrix &&preimage)
+            {
+                for (size_t i = 0; i < m; ++i)
+                {
+                    (*result)(i, j) = std::move(preimage(i, 0));
+                }
+            });
+
+        return result;
+    }
+
+    void DCRTTrapdoorGaussSampBatchToFs(usint n, usint k, const Matrix &publicMatrix, const RLWETrapdoorPair &trapdoor, const Matrix &syndromes, int64_t base, double dggStddev, const rust::String &path, MatrixFileSync sync)
+    {
+        // Only the columns in flight are held in memory; each lands in the file when sampled
+        MatrixFileWriter writer(
+            std::string(path),
+            *publicMatrix(0, 0).GetParams(),
+            publicMatrix.GetCols(),
+            syndromes.GetCols(),
+            Format::EVALUATION,
+            sync);
+
+        GaussSampColumns(
+            n, k, publicMatrix, trapdoor, syndromes, base, dggStddev,
+            [&](size_t j, Matrix &&preimage)
+            { writer.WriteColumn(j, preimage); });
+
+        writer.Finish();
+    }
+
     void DCRTTrapdoorGaussSampToFs(usint n, usint k, const Matrix &publicMatrix, const RLWETrapdoorPair &trapdoor, const DCRTPoly &u, int64_t base, double dggStddev, const rust::String &path)
     {
         lbcrypto::DCRTPoly::DggType dgg(dggStddev);
@@ -117,16 +1229,7 @@ namespace openfhe
             dggLargeSigma,
             base);
 
-        std::string dataPath = std::string(path);
-
-        std::filesystem::path fsPath(dataPath);
-        std::filesystem::create_directories(fsPath.parent_path());
-
-        bool serializeSuccessResult = lbcrypto::Serial::SerializeToFile(dataPath, result, lbcrypto::SerType::BINARY);
-        if (!serializeSuccessResult)
-        {
-            throw std::runtime_error("Failed to serialize result to file");
-        }
+        WriteMatrixFile(result, std::string(path));
     }
 
     std::unique_ptr<Matrix> DCRTSquareMatTrapdoorGaussSamp(usint n, usint k, const Matrix &publicMatrix, const RLWETrapdoorPair &trapdoor, const Matrix &U, int64_t base, double dggStddev)
@@ -154,34 +1257,32 @@ namespace openfhe
 
     void DCRTSquareMatTrapdoorGaussSampToFs(usint n, usint k, const Matrix &publicMatrix, const RLWETrapdoorPair &trapdoor, const Matrix &U, int64_t base, double dggStddev, const rust::String &path)
     {
-        lbcrypto::DCRTPoly::DggType dgg(dggStddev);
-
-        size_t d = U.GetCols(); // U is a square matrix
-
-        double c = (base + 1) * lbcrypto::SIGMA;
-        double s = lbcrypto::SPECTRAL_BOUND_D(n, k, base, d);
-        lbcrypto::DCRTPoly::DggType dggLargeSigma(sqrt(s * s - c * c));
-
-        auto result = lbcrypto::RLWETrapdoorUtility<lbcrypto::DCRTPoly>::GaussSampSquareMat(
-            n,
-            k,
-            publicMatrix,
-            trapdoor,
-            U,
-            dgg,
-            dggLargeSigma,
-            base);
+        const DCRTTrapdoorSampler sampler(publicMatrix(0, 0).GetParams(), publicMatrix, trapdoor, true, base, dggStddev);
+        if (sampler.GetRingDimension() != n || sampler.GetK() != k)
+        {
+            throw std::runtime_error("n and k do not match the trapdoor");
+        }
 
-        std::string dataPath = std::string(path);
+        const size_t d = U.GetCols();
+        MatrixFileWriter writer(
+            std::string(path),
+            *publicMatrix(0, 0).GetParams(),
+            publicMatrix.GetCols(),
+            d,
+            Format::EVALUATION,
+            SYNC_NONE);
 
-        std::filesystem::path fsPath(dataPath);
-        std::filesystem::create_directories(fsPath.parent_path());
+        // The perturbation couples all d columns and is drawn once; the G-lattice step then runs
+        // per column, and each column lands in the file as soon as it is ready
+        lbcrypto::DCRTPoly::DggType dgg = sampler.GetDgg();
+        lbcrypto::DCRTPoly::DggType dggLargeSigma = sampler.GetDggLargeSigma();
+        const Matrix pHat = sampler.SamplePerturbation(dgg, dggLargeSigma);
+        ForEachColumn(
+            sampler, d,
+            [&](size_t j, lbcrypto::DCRTPoly::DggType &columnDgg, lbcrypto::DCRTPoly::DggType &)
+            { writer.WriteColumn(j, sampler.SampleColumnWithPerturbation(U, pHat, j, columnDgg)); });
 
-        bool serializeSuccessResult = lbcrypto::Serial::SerializeToFile(dataPath, result, lbcrypto::SerType::BINARY);
-        if (!serializeSuccessResult)
-        {
-            throw std::runtime_error("Failed to serialize result to file");
-        }
+        writer.Finish();
     }
 
     int64_t GenerateIntegerKarney(double mean, double stddev)
@@ -191,6 +1292,30 @@ namespace openfhe
         return dgg.GenerateIntegerKarney(mean, stddev);
     }
 
+    void GenerateIntegersKarney(double mean, double stddev, rust::Slice<int64_t> out)
+    {
+        // Checked up front: nothing may throw inside the parallel region
+        if (!std::isfinite(mean) || !(stddev > 0.0) || !std::isfinite(stddev))
+        {
+            throw std::runtime_error("Karney sampling needs a finite mean and a positive, finite stddev");
+        }
+
+        const size_t count = out.size();
+        int64_t *dst = out.data();
+
+#pragma omp parallel if (count > 4096)
+        {
+            // dgg is not used in the Karney method; its randomness comes from the thread-local PRNG
+            lbcrypto::DCRTPoly::DggType dgg(0.0);
+
+#pragma omp for schedule(static)
+            for (long iL = 0; iL < static_cast<long>(count); iL++)
+            {
+                dst[static_cast<size_t>(iL)] = dgg.GenerateIntegerKarney(mean, stddev);
+            }
+        }
+    }
+
     std::unique_ptr<Matrix> DCRTPolyGadgetVector(
         usint n,
         size_t size,
@@ -198,7 +1323,7 @@ namespace openfhe
         size_t len,
         int64_t base)
     {
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+        auto params = GetDCRTPolyParams(n, size, kRes);
 
         auto zero_alloc = lbcrypto::DCRTPoly::Allocator(params, Format::EVALUATION);
 
@@ -217,7 +1342,7 @@ namespace openfhe
         size_t towerIdx)
     {
 
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kResBits);
+        auto params = GetDCRTPolyParams(n, size, kResBits);
 
         lbcrypto::NativeInteger qu = params->GetParams()[towerIdx]->GetModulus();
 
@@ -247,6 +1372,88 @@ namespace openfhe
         return result;
     }
 
+    void DCRTGaussSampGqArbBaseInto(
+        const DCRTPoly &syndrome,
+        double c,
+        usint n,
+        size_t size,
+        size_t kResBits,
+        size_t kResDigits,
+        int64_t base,
+        double dggStddev,
+        rust::Slice<int64_t> out)
+    {
+        auto params = GetDCRTPolyParams(n, size, kResBits);
+        if (syndrome.GetNumOfTowers() != size)
+        {
+            throw std::runtime_error("syndrome tower count does not match size");
+        }
+        if (out.size() != size * kResDigits * n)
+        {
+            throw std::runtime_error("out length must equal size * k_res_digits * n");
+        }
+
+        // A single domain switch for every tower
+        const lbcrypto::DCRTPoly *syndromePoly = &syndrome.GetPoly();
+        lbcrypto::DCRTPoly converted;
+        if (syndromePoly->GetFormat() != Format::COEFFICIENT)
+        {
+            converted = *syndromePoly;
+            converted.SetFormat(Format::COEFFICIENT);
+            syndromePoly = &converted;
+        }
+
+#pragma omp parallel if (size > 1)
+        {
+            lbcrypto::DCRTPoly::DggType dgg(dggStddev);
+            lbcrypto::Matrix<int64_t> digits([]()
+                                             { return 0; }, kResDigits, n);
+
+#pragma omp for
+            for (long tL = 0; tL < static_cast<long>(size); ++tL)
+            {
+                const size_t t = static_cast<size_t>(tL);
+                const lbcrypto::NativeInteger &qu = params->GetParams()[t]->GetModulus();
+                lbcrypto::LatticeGaussSampUtility<lbcrypto::NativePoly>::GaussSampGqArbBase(
+                    syndromePoly->GetElementAtIndex(t), c, kResDigits, qu, base, dgg, &digits);
+
+                int64_t *dst = out.data() + (t * kResDigits * n);
+                for (size_t i = 0; i < kResDigits; i++)
+                {
+                    for (size_t j = 0; j < n; j++)
+                    {
+                        dst[i * n + j] = digits(i, j);
+                    }
+                }
+            }
+        }
+    }
+
+    namespace
+    {
+        // Cumulative SampleP1ForPertMat phase times, read through GetSampleP1Timings
+        std::atomic<uint64_t> g_sampleP1Calls{0};
+        std::atomic<uint64_t> g_sampleP1CovarianceNs{0};
+        std::atomic<uint64_t> g_sampleP1CenterNs{0};
+        std::atomic<uint64_t> g_sampleP1SampleNs{0};
+        std::atomic<uint64_t> g_sampleP1AssembleNs{0};
+
+        // Adds the time since the previous call (or construction) to `counter`
+        class PhaseTimer final
+        {
+            std::chrono::steady_clock::time_point m_last = std::chrono::steady_clock::now();
+
+        public:
+            void Lap(std::atomic<uint64_t> &counter)
+            {
+                const auto now = std::chrono::steady_clock::now();
+                counter += static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_last).count());
+                m_last = now;
+            }
+        };
+    } // namespace
+
     std::unique_ptr<Matrix> SampleP1ForPertMat(
         const Matrix &A,
         const Matrix &B,
@@ -260,82 +1467,98 @@ namespace openfhe
         double s,
         double dggStddev)
     {
+        PhaseTimer timer;
         size_t d = A.GetRows();
 
-        auto params = std::make_shared<lbcrypto::ILDCRTParams<lbcrypto::BigInteger>>(2 * n, size, kRes);
+        auto params = GetDCRTPolyParams(n, size, kRes);
 
         lbcrypto::DCRTPoly::DggType dgg(dggStddev);
 
         auto zero_alloc = lbcrypto::DCRTPoly::Allocator(params, Format::EVALUATION);
 
-        lbcrypto::Matrix<lbcrypto::Field2n> AF([&]()
-                                               { return lbcrypto::Field2n(n, Format::EVALUATION, true); }, d, d);
-        lbcrypto::Matrix<lbcrypto::Field2n> BF([&]()
-                                               { return lbcrypto::Field2n(n, Format::EVALUATION, true); }, d, d);
-        lbcrypto::Matrix<lbcrypto::Field2n> DF([&]()
-                                               { return lbcrypto::Field2n(n, Format::EVALUATION, true); }, d, d);
+        // Every Field2n below is allocated once here and the coefficients are written into it in
+        // place; only the DFT in SetFormat works on its own buffers
+        auto field_alloc = [&]()
+        { return lbcrypto::Field2n(n, Format::COEFFICIENT, true); };
+        lbcrypto::Matrix<lbcrypto::Field2n> AF(field_alloc, d, d);
+        lbcrypto::Matrix<lbcrypto::Field2n> BF(field_alloc, d, d);
+        lbcrypto::Matrix<lbcrypto::Field2n> DF(field_alloc, d, d);
 
-        double scalarFactor = -sigma * sigma;
+        const double scalarFactor = -sigma * sigma;
 
-        for (size_t i = 0; i < d; i++)
-        {
-            for (size_t j = 0; j < d; j++)
+        // -sigma^2 X (+ s^2 on the diagonal of A and D), then to DFT representation, for all
+        // three d x d blocks at once
+        ParallelFor(
+            3 * d * d,
+            [&](size_t item)
             {
-                AF(i, j) = lbcrypto::Field2n(A(i, j));
-                AF(i, j) = AF(i, j).ScalarMult(scalarFactor);
-                BF(i, j) = lbcrypto::Field2n(B(i, j));
-                BF(i, j) = BF(i, j).ScalarMult(scalarFactor);
-                DF(i, j) = lbcrypto::Field2n(D(i, j));
-                DF(i, j) = DF(i, j).ScalarMult(scalarFactor);
-                if (i == j)
+                const size_t which = item / (d * d);
+                const size_t i = (item / d) % d;
+                const size_t j = item % d;
+
+                const Matrix &src = which == 0 ? A : (which == 1 ? B : D);
+                lbcrypto::Field2n &dst = which == 0 ? AF(i, j) : (which == 1 ? BF(i, j) : DF(i, j));
+
+                AssignScaledField2n(dst, src(i, j), scalarFactor);
+                if (which != 1 && i == j)
                 {
-                    AF(i, j) = AF(i, j) + s * s;
-                    DF(i, j) = DF(i, j) + s * s;
+                    // constant term of the coefficient representation
+                    dst[0] += s * s;
                 }
-            }
-        }
+                dst.SetFormat(Format::EVALUATION);
+            });
+        timer.Lap(g_sampleP1CovarianceNs);
 
-        // converts the field elements to DFT representation
-        AF.SetFormat(Format::EVALUATION);
-        BF.SetFormat(Format::EVALUATION);
-        DF.SetFormat(Format::EVALUATION);
-
-        lbcrypto::Matrix<lbcrypto::Field2n> c([&]()
-                                              { return lbcrypto::Field2n(n, Format::COEFFICIENT); }, 2 * d, ncol);
-        double cScale = -sigma * sigma / (s * s - sigma * sigma);
+        lbcrypto::Matrix<lbcrypto::Field2n> c(field_alloc, 2 * d, ncol);
+        const double cScale = -sigma * sigma / (s * s - sigma * sigma);
 
-#pragma omp parallel for if (ncol > 1)
-        for (long jL = 0; jL < static_cast<long>(ncol); ++jL)
-        {
-            size_t j = static_cast<size_t>(jL);
-            for (size_t i = 0; i < d; i++)
-            {
-                c(i, j) = lbcrypto::Field2n(tp2(i, j)).ScalarMult(cScale);
-                c(i + d, j) = lbcrypto::Field2n(tp2(i + d, j)).ScalarMult(cScale);
-            }
-        }
+        ParallelFor(
+            2 * d * ncol,
+            [&](size_t item)
+            { AssignScaledField2n(c(item / ncol, item % ncol), tp2(item / ncol, item % ncol), cScale); });
+        timer.Lap(g_sampleP1CenterNs);
 
         auto p1ZVector = std::make_shared<lbcrypto::Matrix<int64_t>>([]()
                                                                      { return 0; }, n * 2 * d, ncol);
         lbcrypto::LatticeGaussSampUtility<lbcrypto::DCRTPoly>::SampleMat(AF, BF, DF, c, dgg, p1ZVector);
+        timer.Lap(g_sampleP1SampleNs);
 
-        lbcrypto::Matrix<lbcrypto::DCRTPoly> p1(zero_alloc, 1, 1);
-        std::vector<lbcrypto::Matrix<lbcrypto::DCRTPoly>> p1Cols(ncol);
-#pragma omp parallel for if (ncol > 1)
-        for (long jL = 0; jL < static_cast<long>(ncol); ++jL)
-        {
-            size_t j = static_cast<size_t>(jL);
-            p1Cols[j] = lbcrypto::SplitInt64IntoElements<lbcrypto::DCRTPoly>(p1ZVector->ExtractCol(j), n, params);
-        }
-        if (ncol > 0)
-        {
-            p1 = p1Cols[0];
-            for (size_t j = 1; j < ncol; ++j)
-                p1.HStack(p1Cols[j]);
-        }
-
-        p1.SetFormat(Format::EVALUATION);
+        // Each column is split and converted straight into its slot of the pre-sized result
+        Matrix p1(zero_alloc, 2 * d, ncol);
+        ParallelFor(
+            ncol,
+            [&](size_t j)
+            {
+                Matrix col = lbcrypto::SplitInt64IntoElements<lbcrypto::DCRTPoly>(p1ZVector->ExtractCol(j), n, params);
+                for (size_t i = 0; i < 2 * d; i++)
+                {
+                    col(i, 0).SetFormat(Format::EVALUATION);
+                    p1(i, j) = std::move(col(i, 0));
+                }
+            });
+        timer.Lap(g_sampleP1AssembleNs);
+        g_sampleP1Calls++;
 
         return std::make_unique<Matrix>(std::move(p1));
     }
+
+    SampleP1Timings GetSampleP1Timings() noexcept
+    {
+        SampleP1Timings timings;
+        timings.calls = g_sampleP1Calls.load();
+        timings.covariance_ns = g_sampleP1CovarianceNs.load();
+        timings.center_ns = g_sampleP1CenterNs.load();
+        timings.sample_ns = g_sampleP1SampleNs.load();
+        timings.assemble_ns = g_sampleP1AssembleNs.load();
+        return timings;
+    }
+
+    void ResetSampleP1Timings() noexcept
+    {
+        g_sampleP1Calls = 0;
+        g_sampleP1CovarianceNs = 0;
+        g_sampleP1CenterNs = 0;
+        g_sampleP1SampleNs = 0;
+        g_sampleP1AssembleNs = 0;
+    }
 } // openfhe
@@ -1,10 +1,20 @@
 #pragma once
 #include "openfhe/core/lattice/trapdoor.h"
 #include "DCRTPoly.h"
+#include "MatrixFile.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace openfhe
 {
 
+    struct SampleP1Timings;
+
     using RLWETrapdoorPair = lbcrypto::RLWETrapdoorPair<lbcrypto::DCRTPoly>;
 
     class DCRTTrapdoor final
@@ -23,8 +33,217 @@ namespace openfhe
         [[nodiscard]] std::unique_ptr<RLWETrapdoorPair> GetTrapdoorPair() const;
         [[nodiscard]] std::unique_ptr<Matrix> GetPublicMatrix() const;
         [[nodiscard]] std::unique_ptr<DCRTPoly> GetPublicMatrixElement(size_t row, size_t col) const;
+        // Borrowed views into the trapdoor's own storage
+        [[nodiscard]] const Matrix &GetPublicMatrixRef() const noexcept;
+        [[nodiscard]] std::unique_ptr<DCRTPoly> GetPublicMatrixElementRef(size_t row, size_t col) const;
+        [[nodiscard]] const RLWETrapdoorPair &GetTrapdoorPairRef() const noexcept;
+        // Move the parts out without copying; the trapdoor is left empty afterwards.
+        [[nodiscard]] std::unique_ptr<Matrix> TakePublicMatrix();
+        [[nodiscard]] std::unique_ptr<RLWETrapdoorPair> TakeTrapdoorPair();
+    };
+
+    // Both trapdoor matrices in one archive, written into / read from Rust buffers in place.
+    // Deserialization returns null on malformed input and gives the matrices the EVALUATION
+    // allocator of (n, size, kRes).
+    [[nodiscard]] rust::Vec<uint8_t> RLWETrapdoorPairSerializeToBytes(
+        const RLWETrapdoorPair &trapdoorPair,
+        const SerialMode serialMode);
+    [[nodiscard]] std::unique_ptr<RLWETrapdoorPair> RLWETrapdoorPairDeserializeFromBytes(
+        usint n,
+        size_t size,
+        size_t kRes,
+        rust::Slice<const uint8_t> data,
+        const SerialMode serialMode);
+
+    // cxx currently does not support std::vector of opaque type
+    class VectorOfDCRTTrapdoors final
+    {
+        std::vector<std::unique_ptr<DCRTTrapdoor>> m_trapdoors;
+
+    public:
+        explicit VectorOfDCRTTrapdoors(std::vector<std::unique_ptr<DCRTTrapdoor>> &&trapdoors) noexcept;
+        VectorOfDCRTTrapdoors(const VectorOfDCRTTrapdoors &) = delete;
+        VectorOfDCRTTrapdoors(VectorOfDCRTTrapdoors &&) = delete;
+        VectorOfDCRTTrapdoors &operator=(const VectorOfDCRTTrapdoors &) = delete;
+        VectorOfDCRTTrapdoors &operator=(VectorOfDCRTTrapdoors &&) = delete;
+
+        [[nodiscard]] size_t GetSize() const noexcept;
+        [[nodiscard]] const DCRTTrapdoor &GetElement(size_t index) const;
+        // Moves trapdoor `index` out of the vector; its slot is left empty.
+        [[nodiscard]] std::unique_ptr<DCRTTrapdoor> TakeElement(size_t index);
+    };
+
+    // Preimage sampler bound to one trapdoor. The FFT-domain perturbation covariance derived from
+    // the trapdoor, the spectral bound and both discrete Gaussian samplers are built once, so each
+    // Sample call only draws fresh randomness and does the per-syndrome arithmetic.
+    // The sampler keeps its own copy of the public matrix and of the trapdoor rows (d(k + 2) and
+    // 2dk polys) so it stays valid after the caller drops the trapdoor; that copy is paid once,
+    // at construction, next to the covariance set-up.
+    class DCRTTrapdoorSampler final
+    {
+        using DggType = lbcrypto::DCRTPoly::DggType;
+        using FieldMatrix = lbcrypto::Matrix<lbcrypto::Field2n>;
+
+        std::shared_ptr<lbcrypto::DCRTPoly::Params> m_params;
+        Matrix m_publicMatrix;
+        // [e; r] for the 1 x (k + 2) trapdoor, [R; E] for the square one, so row block 0 always
+        // pairs with the first perturbation block of the preimage.
+        Matrix m_tPrime;
+        bool m_square;
+        usint m_n;
+        size_t m_d;
+        size_t m_k;
+        int64_t m_base;
+        double m_c;
+        double m_s;
+        double m_sigmaLarge;
+        DggType m_dgg;
+        DggType m_dggLargeSigma;
+        FieldMatrix m_covA;
+        FieldMatrix m_covB;
+        FieldMatrix m_covD;
+
+    public:
+        DCRTTrapdoorSampler(
+            std::shared_ptr<lbcrypto::DCRTPoly::Params> params,
+            const Matrix &publicMatrix,
+            const RLWETrapdoorPair &trapdoor,
+            bool square,
+            int64_t base,
+            double dggStddev);
+        DCRTTrapdoorSampler(const DCRTTrapdoorSampler &) = delete;
+        DCRTTrapdoorSampler(DCRTTrapdoorSampler &&) = delete;
+        DCRTTrapdoorSampler &operator=(const DCRTTrapdoorSampler &) = delete;
+        DCRTTrapdoorSampler &operator=(DCRTTrapdoorSampler &&) = delete;
+
+        // Preimage of u under the 1 x (k + 2) public matrix, as a (k + 2) x 1 matrix.
+        [[nodiscard]] std::unique_ptr<Matrix> Sample(const DCRTPoly &u);
+        // Preimage of the d x d matrix U under the d x d(k + 2) public matrix.
+        [[nodiscard]] std::unique_ptr<Matrix> SampleSquareMat(const Matrix &U);
+
+        // The two halves of a sample, for callers that keep their own samplers per thread.
+        // The perturbation does not depend on the syndrome and can be drawn ahead of time.
+        [[nodiscard]] Matrix SamplePerturbation(DggType &dgg, DggType &dggLargeSigma) const;
+        [[nodiscard]] Matrix SampleWithPerturbation(const Matrix &U, const Matrix &pHat, DggType &dgg) const;
+        // Column `col` of SampleWithPerturbation; columns are independent once pHat is drawn.
+        [[nodiscard]] Matrix SampleColumnWithPerturbation(const Matrix &U, const Matrix &pHat, size_t col, DggType &dgg) const;
+        [[nodiscard]] const DggType &GetDgg() const noexcept;
+        [[nodiscard]] const DggType &GetDggLargeSigma() const noexcept;
+        [[nodiscard]] bool IsSquare() const noexcept;
+        [[nodiscard]] usint GetRingDimension() const noexcept;
+        // Gadget length k per row of the trapdoor
+        [[nodiscard]] size_t GetK() const noexcept;
+    };
+
+    // Bounded pool of perturbation vectors drawn ahead of time by background threads. Sampling
+    // pops one and only runs the syndrome-dependent G-lattice step; when the pool is empty the
+    // perturbation is drawn inline instead of waiting. A worker that fails stops, and its
+    // exception is rethrown from the next Sample or SampleSquareMat call.
+    class DCRTPerturbationPool final
+    {
+        DCRTTrapdoorSampler m_sampler;
+        size_t m_capacity;
+        std::deque<Matrix> m_pool;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_notFull;
+        bool m_stop = false;
+        // First failure of a worker, which then stops; rethrown by the next Sample call
+        std::exception_ptr m_workerError;
+        // Used by the online path, which Rust only reaches through a unique reference
+        lbcrypto::DCRTPoly::DggType m_dgg;
+        lbcrypto::DCRTPoly::DggType m_dggLargeSigma;
+        std::vector<std::thread> m_workers;
+
+        void Fill();
+        // Signals and joins every started worker
+        void StopWorkers() noexcept;
+        [[nodiscard]] Matrix TakePerturbation();
+
+    public:
+        DCRTPerturbationPool(
+            std::shared_ptr<lbcrypto::DCRTPoly::Params> params,
+            const Matrix &publicMatrix,
+            const RLWETrapdoorPair &trapdoor,
+            bool square,
+            int64_t base,
+            double dggStddev,
+            size_t capacity,
+            size_t workers);
+        DCRTPerturbationPool(const DCRTPerturbationPool &) = delete;
+        DCRTPerturbationPool(DCRTPerturbationPool &&) = delete;
+        DCRTPerturbationPool &operator=(const DCRTPerturbationPool &) = delete;
+        DCRTPerturbationPool &operator=(DCRTPerturbationPool &&) = delete;
+        ~DCRTPerturbationPool();
+
+        [[nodiscard]] std::unique_ptr<Matrix> Sample(const DCRTPoly &u);
+        [[nodiscard]] std::unique_ptr<Matrix> SampleSquareMat(const Matrix &U);
+        // Perturbations ready right now
+        [[nodiscard]] size_t GetAvailable() const;
     };
 
+    [[nodiscard]] std::unique_ptr<DCRTPerturbationPool> DCRTPerturbationPoolGen(
+        usint n,
+        size_t size,
+        size_t kRes,
+        const Matrix &publicMatrix,
+        const RLWETrapdoorPair &trapdoor,
+        bool square,
+        int64_t base,
+        double dggStddev,
+        size_t capacity,
+        size_t workers);
+
+    [[nodiscard]] std::unique_ptr<DCRTTrapdoorSampler> DCRTTrapdoorSamplerGen(
+        usint n,
+        size_t size,
+        size_t kRes,
+        const Matrix &publicMatrix,
+        const RLWETrapdoorPair &trapdoor,
+        int64_t base,
+        double dggStddev);
+
+    [[nodiscard]] std::unique_ptr<DCRTTrapdoorSampler> DCRTSquareMatTrapdoorSamplerGen(
+        usint n,
+        size_t size,
+        size_t kRes,
+        const Matrix &publicMatrix,
+        const RLWETrapdoorPair &trapdoor,
+        int64_t base,
+        double dggStddev);
+
+    // Zero-centred discrete Gaussian with a fixed standard deviation, sampled by inversion of a
+    // cumulative table tail-cut at 12 sigma. One 64-bit draw per sample: the top bit is the sign,
+    // the rest is looked up in the table of P(|x| <= k) scaled to 2^63. Bulk calls split the output
+    // across OpenMP threads, each drawing from its own thread-local PRNG stream.
+    class DiscreteGaussianCDT final
+    {
+        double m_std;
+        std::vector<uint64_t> m_cdf;
+
+    public:
+        explicit DiscreteGaussianCDT(double stddev);
+        DiscreteGaussianCDT(const DiscreteGaussianCDT &) = delete;
+        DiscreteGaussianCDT(DiscreteGaussianCDT &&) = delete;
+        DiscreteGaussianCDT &operator=(const DiscreteGaussianCDT &) = delete;
+        DiscreteGaussianCDT &operator=(DiscreteGaussianCDT &&) = delete;
+
+        [[nodiscard]] double GetStd() const noexcept;
+        // One sample from any engine producing 32-bit words
+        template <typename Engine>
+        [[nodiscard]] int64_t Sample(Engine &prng) const
+        {
+            const uint64_t r = (static_cast<uint64_t>(prng()) << 32) | static_cast<uint32_t>(prng());
+            const uint64_t u = r & ((uint64_t(1) << 63) - 1);
+            const auto k = static_cast<int64_t>(std::upper_bound(m_cdf.begin(), m_cdf.end(), u) - m_cdf.begin());
+            return (r >> 63) != 0 ? -k : k;
+        }
+        void SampleInto(rust::Slice<int64_t> out) const;
+        // n samples reduced straight into every tower, returned in EVALUATION format
+        [[nodiscard]] std::unique_ptr<DCRTPoly> SamplePoly(usint n, size_t size, size_t kRes) const;
+    };
+
+    [[nodiscard]] std::unique_ptr<DiscreteGaussianCDT> DiscreteGaussianCDTGen(double stddev);
+
     // Generator functions
     [[nodiscard]] std::unique_ptr<DCRTTrapdoor> DCRTTrapdoorGen(
         usint n,
@@ -43,6 +262,56 @@ namespace openfhe
         int64_t base,
         bool balanced);
 
+    // Seeded trapdoors draw every uniform and Gaussian entry from the ChaCha stream (seed, stream),
+    // so the same arguments regenerate a bit-identical public matrix and trapdoor and only the
+    // seed needs to be stored. Gaussians come from a CDT table, so stddev is at most 65536; the
+    // table is built with integer arithmetic, so a seed expands the same way on every platform.
+    [[nodiscard]] std::unique_ptr<DCRTTrapdoor> DCRTTrapdoorGenSeeded(
+        usint n,
+        size_t size,
+        size_t kRes,
+        double stddev,
+        int64_t base,
+        bool balanced,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream);
+
+    [[nodiscard]] std::unique_ptr<DCRTTrapdoor> DCRTSquareMatTrapdoorGenSeeded(
+        usint n,
+        size_t size,
+        size_t kRes,
+        size_t d,
+        double stddev,
+        int64_t base,
+        bool balanced,
+        rust::Slice<const uint8_t> seed,
+        uint64_t stream);
+
+    // `count` independent trapdoors generated in parallel. With an empty `seed` each thread draws
+    // from its own OpenFHE PRNG; otherwise trapdoor i is the seeded one for stream firstStream + i.
+    [[nodiscard]] std::unique_ptr<VectorOfDCRTTrapdoors> DCRTTrapdoorGenBatch(
+        usint n,
+        size_t size,
+        size_t kRes,
+        double stddev,
+        int64_t base,
+        bool balanced,
+        size_t count,
+        rust::Slice<const uint8_t> seed,
+        uint64_t firstStream);
+
+    [[nodiscard]] std::unique_ptr<VectorOfDCRTTrapdoors> DCRTSquareMatTrapdoorGenBatch(
+        usint n,
+        size_t size,
+        size_t kRes,
+        size_t d,
+        double stddev,
+        int64_t base,
+        bool balanced,
+        size_t count,
+        rust::Slice<const uint8_t> seed,
+        uint64_t firstStream);
+
     // Gauss sample functions
     [[nodiscard]] std::unique_ptr<Matrix> DCRTTrapdoorGaussSamp(
         usint n,
@@ -62,6 +331,32 @@ namespace openfhe
         int64_t base,
         double dggStddev);
 
+    // One preimage per column of the 1 x count `syndromes` matrix, returned as the columns of a
+    // (k + 2) x count matrix. Sampler setup is shared and the columns are sampled in parallel.
+    [[nodiscard]] std::unique_ptr<Matrix> DCRTTrapdoorGaussSampBatch(
+        usint n,
+        usint k,
+        const Matrix &publicMatrix,
+        const RLWETrapdoorPair &trapdoor,
+        const Matrix &syndromes,
+        int64_t base,
+        double dggStddev);
+
+    // Streaming variant of DCRTTrapdoorGaussSampBatch: each preimage column is written to a matrix
+    // file (readable by GetMatrixFromFs / MappedMatrixOpen) as soon as it is sampled.
+    void DCRTTrapdoorGaussSampBatchToFs(
+        usint n,
+        usint k,
+        const Matrix &publicMatrix,
+        const RLWETrapdoorPair &trapdoor,
+        const Matrix &syndromes,
+        int64_t base,
+        double dggStddev,
+        const rust::String &path,
+        MatrixFileSync sync);
+
+    // Writes the preimage in the fixed MatrixFile.h layout, not cereal; GetMatrixFromFs reads
+    // both. Callers that need a cereal blob use MatrixSerializeToBytes on the sampled matrix.
     void DCRTTrapdoorGaussSampToFs(
         usint n,
         usint k,
@@ -72,6 +367,8 @@ namespace openfhe
         double dggStddev,
         const rust::String &path);
 
+    // Draws the joint perturbation once, then samples and writes one preimage column at a time
+    // in the fixed MatrixFile.h layout, so the full preimage is never held in memory.
     void DCRTSquareMatTrapdoorGaussSampToFs(
         usint n,
         usint k,
@@ -86,6 +383,13 @@ namespace openfhe
         double mean,
         double stddev);
 
+    // Fills `out` with Karney samples; the work is split across threads, each with its own sampler.
+    // Throws on a non-finite mean or a stddev that is not positive and finite.
+    void GenerateIntegersKarney(
+        double mean,
+        double stddev,
+        rust::Slice<int64_t> out);
+
     [[nodiscard]] std::unique_ptr<Matrix> DCRTPolyGadgetVector(
         usint n,
         size_t size,
@@ -104,6 +408,19 @@ namespace openfhe
         double dggStddev,
         size_t towerIdx);
 
+    // All towers of the syndrome in one call: converted to COEFFICIENT once, sampled in parallel
+    // with a sampler per thread, digits written to `out` as size x kResDigits x n.
+    void DCRTGaussSampGqArbBaseInto(
+        const DCRTPoly &syndrome,
+        double c,
+        usint n,
+        size_t size,
+        size_t kResBits,
+        size_t kResDigits,
+        int64_t base,
+        double dggStddev,
+        rust::Slice<int64_t> out);
+
     [[nodiscard]] std::unique_ptr<Matrix> SampleP1ForPertMat(
         const Matrix &A,
         const Matrix &B,
@@ -116,4 +433,8 @@ namespace openfhe
         double sigma,
         double s,
         double dggStddev);
+
+    // Process-wide SampleP1ForPertMat phase times accumulated since the last reset
+    [[nodiscard]] SampleP1Timings GetSampleP1Timings() noexcept;
+    void ResetSampleP1Timings() noexcept;
 } // openfhe
\ No newline at end of file
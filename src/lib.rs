@@ -45,6 +45,13 @@ pub mod ffi {
         HYBRID,
     }
 
+    #[repr(i32)]
+    enum MatrixFileSync {
+        SYNC_NONE = 0,
+        SYNC_ON_FINISH = 1,
+        SYNC_EVERY_COLUMN = 2,
+    }
+
     #[repr(i32)]
     enum MultipartyMode {
         INVALID_MULTIPARTY_MODE = 0,
@@ -138,6 +145,15 @@ pub mod ffi {
         im: f64,
     }
 
+    // Cumulative SampleP1ForPertMat phase times in nanoseconds
+    struct SampleP1Timings {
+        calls: u64,
+        covariance_ns: u64,
+        center_ns: u64,
+        sample_ns: u64,
+        assemble_ns: u64,
+    }
+
     unsafe extern "C++" {
         // includes
         include!("openfhe/src/AssociativeContainers.h");
@@ -150,6 +166,7 @@ pub mod ffi {
         include!("openfhe/src/EvalKey.h");
         include!("openfhe/src/KeyPair.h");
         include!("openfhe/src/LWEPrivateKey.h");
+        include!("openfhe/src/MatrixFile.h");
         include!("openfhe/src/Params.h");
         include!("openfhe/src/Plaintext.h");
         include!("openfhe/src/PrivateKey.h");
@@ -168,6 +185,7 @@ pub mod ffi {
         type ExecutionMode;
         type Format;
         type KeySwitchTechnique;
+        type MatrixFileSync;
         type MultipartyMode;
         type MultiplicationTechnique;
         type PKESchemeFeature;
@@ -181,13 +199,17 @@ pub mod ffi {
 
         // types
         type CiphertextDCRTPoly;
+        type CRTBasis;
         type CryptoContextDCRTPoly;
         type CryptoParametersBaseDCRTPoly;
         type ElementParams;
         type DCRTPoly;
         type DCRTPolyParams;
+        type DCRTPerturbationPool;
         type DCRTTrapdoor;
+        type DCRTTrapdoorSampler;
         type DecryptResult;
+        type DiscreteGaussianCDT;
         type EncodingParams;
         type EvalKeyDCRTPoly;
         type KeyPairDCRTPoly;
@@ -195,7 +217,10 @@ pub mod ffi {
         type MapFromIndexToEvalKey;
         type MapFromStringToMapFromIndexToEvalKey;
         type MapFromStringToVectorOfEvalKeys;
+        type MappedMatrix;
         type Matrix;
+        type MatrixFileWriter;
+        type MatrixView;
         type Params;
         type ParamsBFVRNS;
         type ParamsBGVRNS;
@@ -209,6 +234,7 @@ pub mod ffi {
         type UnorderedMapFromIndexToDCRTPoly;
         type VectorOfCiphertexts;
         type VectorOfDCRTPolys;
+        type VectorOfDCRTTrapdoors;
         type VectorOfEvalKeys;
         type VectorOfLWECiphertexts;
         type VectorOfPolys;
@@ -1223,8 +1249,37 @@ pub mod ffi {
         fn GetCoefficients(self: &DCRTPoly) -> Vec<String>;
         fn GetCoefficientsBytes(self: &DCRTPoly) -> Vec<u8>;
         fn GetModulus(self: &DCRTPoly) -> String;
+        fn GetNumOfTowers(self: &DCRTPoly) -> usize;
+        fn GetRingDimension(self: &DCRTPoly) -> usize;
+        fn GetFormat(self: &DCRTPoly) -> Format;
+        // Borrowed RNS residues of one tower, in the poly's current format
+        fn GetTowerValues(self: &DCRTPoly, tower_idx: usize) -> &[u64];
+        // Tower-major copy of all residues (size * n values) in the requested format
+        fn WriteTowersInto(self: &DCRTPoly, format: Format, out: &mut [u64]);
+        // CRT-interpolated coefficients as `n * limbs_per_int` little-endian limbs
+        fn WriteCoefficientsLimbsInto(self: &DCRTPoly, limbs_per_int: usize, out: &mut [u64]);
         fn Negate(self: &DCRTPoly) -> UniquePtr<DCRTPoly>;
         fn Decompose(self: &DCRTPoly, base_bits: u32) -> UniquePtr<Matrix>;
+        fn GetDecomposeLength(self: &DCRTPoly, base_bits: u32) -> usize;
+        // Digits written straight into `out` from (row, col), down a column or along the row;
+        // errors when they do not fit
+        fn DecomposeInto(
+            self: &DCRTPoly,
+            base_bits: u32,
+            out: Pin<&mut Matrix>,
+            row: usize,
+            col: usize,
+            column: bool,
+            format: Format,
+        ) -> Result<()>;
+        // Explicit domain switch of every tower
+        fn SetFormat(self: Pin<&mut DCRTPoly>, format: Format);
+        fn AddAssign(self: Pin<&mut DCRTPoly>, rhs: &DCRTPoly) -> Result<()>;
+        fn SubAssign(self: Pin<&mut DCRTPoly>, rhs: &DCRTPoly) -> Result<()>;
+        fn MulAssign(self: Pin<&mut DCRTPoly>, rhs: &DCRTPoly) -> Result<()>;
+        fn ScalarMulAssign(self: Pin<&mut DCRTPoly>, scalar: u64);
+        // Scalar as little-endian u64 limbs
+        fn ScalarMulLimbsAssign(self: Pin<&mut DCRTPoly>, scalar_limbs: &[u64]);
 
         // Generator functions
         fn DCRTPolyGenFromConst(
@@ -1248,21 +1303,66 @@ pub mod ffi {
             values_limbs: &[u64],
             limbs_per_int: usize,
         ) -> UniquePtr<DCRTPoly>;
+        // Create DCRTPoly from tower-major RNS residues (`size` slices of `n` values)
+        fn DCRTPolyGenFromRnsVec(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            residues: &[u64],
+        ) -> UniquePtr<DCRTPoly>;
+        fn DCRTPolyGenFromRnsEvalVec(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            residues: &[u64],
+        ) -> UniquePtr<DCRTPoly>;
         fn DCRTPolyGenFromBug(n: u32, size: usize, k_res: usize) -> UniquePtr<DCRTPoly>;
         fn DCRTPolyGenFromDug(n: u32, size: usize, k_res: usize) -> UniquePtr<DCRTPoly>;
         fn DCRTPolyGenFromDgg(n: u32, size: usize, k_res: usize, sigma: f64)
             -> UniquePtr<DCRTPoly>;
         fn DCRTPolyGenFromTug(n: u32, size: usize, k_res: usize) -> UniquePtr<DCRTPoly>;
+        // Uniform poly expanded from a 32-byte seed, identical for the same (seed, stream)
+        fn DCRTPolyGenFromDugSeeded(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            seed: &[u8],
+            stream: u64,
+        ) -> UniquePtr<DCRTPoly>;
 
         // Arithmetic
         fn DCRTPolyAdd(rhs: &DCRTPoly, lhs: &DCRTPoly) -> UniquePtr<DCRTPoly>;
         fn DCRTPolyMul(rhs: &DCRTPoly, lhs: &DCRTPoly) -> UniquePtr<DCRTPoly>;
+        // lhs - rhs
+        fn DCRTPolySub(lhs: &DCRTPoly, rhs: &DCRTPoly) -> UniquePtr<DCRTPoly>;
+        fn DCRTPolyScalarMul(poly: &DCRTPoly, scalar: u64) -> UniquePtr<DCRTPoly>;
+        fn DCRTPolyScalarMulLimbs(poly: &DCRTPoly, scalar_limbs: &[u64]) -> UniquePtr<DCRTPoly>;
+        // acc += a * b on EVALUATION-format towers, without allocating
+        fn DCRTPolyMulAdd(acc: Pin<&mut DCRTPoly>, a: &DCRTPoly, b: &DCRTPoly) -> Result<()>;
     }
 
     // DCRTPolyParams
     unsafe extern "C++" {
         // Generator functions
         fn DCRTPolyGenNullParams() -> UniquePtr<DCRTPolyParams>;
+        // Cached params shared by every poly, matrix and trapdoor built from (n, size, k_res)
+        fn DCRTPolyGenParams(n: u32, size: usize, k_res: usize) -> UniquePtr<DCRTPolyParams>;
+        fn DCRTPolyClearParamsCache();
+    }
+
+    // CRTBasis
+    unsafe extern "C++" {
+        // Cached alongside the params for (n, size, k_res); prefer it over GenModulus/GenCRTBasis
+        fn DCRTPolyGenCRTBasis(n: u32, size: usize, k_res: usize) -> SharedPtr<CRTBasis>;
+        fn GetRingDimension(self: &CRTBasis) -> u32;
+        // q_0, ..., q_{size-1}
+        fn GetModuli(self: &CRTBasis) -> &[u64];
+        // Q = prod q_t, little-endian
+        fn GetModulusLimbs(self: &CRTBasis) -> &[u64];
+        // Q/q_t for every tower, each GetModulusLimbs().len() little-endian limbs
+        fn GetQHat(self: &CRTBasis) -> &[u64];
+        // [(Q/q_t)^-1]_{q_t}
+        fn GetQHatInv(self: &CRTBasis) -> &[u64];
     }
 
     // Matrix
@@ -1274,9 +1374,43 @@ pub mod ffi {
             nrow: usize,
             ncol: usize,
         ) -> UniquePtr<Matrix>;
-        fn GetMatrixFromFs(n: u32, size: usize, k_res: usize, path: &String) -> UniquePtr<Matrix>;
+        // Uniform matrix expanded from a 32-byte seed; entries expand in parallel
+        fn MatrixGenFromDugSeeded(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            nrow: usize,
+            ncol: usize,
+            seed: &[u8],
+            stream: u64,
+        ) -> UniquePtr<Matrix>;
+        fn GetMatrixFromFs(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            path: &String,
+        ) -> Result<UniquePtr<Matrix>>;
         fn SetMatrixElement(matrix: Pin<&mut Matrix>, row: usize, col: usize, element: &DCRTPoly);
         fn GetMatrixElement(matrix: &Matrix, row: usize, col: usize) -> UniquePtr<DCRTPoly>;
+        // Non-owning entry views, no tower copies; use `MatrixElementRef` / `MatrixElementMut`,
+        // which tie the view to the matrix's lifetime
+        unsafe fn GetMatrixElementRef(
+            matrix: &Matrix,
+            row: usize,
+            col: usize,
+        ) -> UniquePtr<DCRTPoly>;
+        unsafe fn GetMatrixElementMut(
+            matrix: Pin<&mut Matrix>,
+            row: usize,
+            col: usize,
+        ) -> UniquePtr<DCRTPoly>;
+        // Moves the element into the matrix
+        fn SetMatrixElementOwned(
+            matrix: Pin<&mut Matrix>,
+            row: usize,
+            col: usize,
+            element: UniquePtr<DCRTPoly>,
+        );
         fn GetMatrixRows(matrix: &Matrix) -> usize;
         fn GetMatrixCols(matrix: &Matrix) -> usize;
         fn ExtractMatrixRow(matrix: &Matrix, row: usize) -> UniquePtr<Matrix>;
@@ -1284,6 +1418,125 @@ pub mod ffi {
         fn ExtractMatrixRows(matrix: &Matrix, startRow: usize, endRow: usize) -> UniquePtr<Matrix>;
         fn ExtractMatrixCols(matrix: &Matrix, startCol: usize, endCol: usize) -> UniquePtr<Matrix>;
         fn FormatMatrixCoefficient(matrix: Pin<&mut Matrix>);
+        // In-place conversion of every entry, parallel over entries and towers
+        fn FormatMatrix(matrix: Pin<&mut Matrix>, format: Format);
+        // Products and sums over EVALUATION-format matrices; shape, format and tower mismatches
+        // are errors
+        fn MatrixMul(a: &Matrix, b: &Matrix) -> Result<UniquePtr<Matrix>>;
+        // c += a * b
+        fn MatrixMulAccumulate(c: Pin<&mut Matrix>, a: &Matrix, b: &Matrix) -> Result<()>;
+        fn MatrixAdd(a: &Matrix, b: &Matrix) -> Result<UniquePtr<Matrix>>;
+        fn MatrixSub(a: &Matrix, b: &Matrix) -> Result<UniquePtr<Matrix>>;
+        fn MatrixScalarMul(matrix: &Matrix, scalar: &DCRTPoly) -> Result<UniquePtr<Matrix>>;
+        fn MatrixViewMul(a: &MatrixView, b: &MatrixView) -> Result<UniquePtr<Matrix>>;
+        // Every entry expanded into a k x 1 block of digits, k = GetDecomposeLength(base_bits)
+        fn MatrixDecompose(
+            matrix: &Matrix,
+            base_bits: u32,
+            format: Format,
+        ) -> Result<UniquePtr<Matrix>>;
+        // Digits per tower of the CRT gadget; the gadget row length is size * digits
+        fn GadgetDigitsPerTower(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            base: i64,
+            balanced: bool,
+        ) -> Result<usize>;
+        // G^{-1} for an arbitrary integer base, optionally with balanced digits; errors on a base
+        // outside [2, 2^31), an empty matrix or entries with different towers
+        fn MatrixGadgetDecompose(
+            matrix: &Matrix,
+            base: i64,
+            balanced: bool,
+        ) -> Result<UniquePtr<Matrix>>;
+        // X * G and G * X for the gadget row of length `len`, without building G; errors on a
+        // bad base or length, or on entries that are not all EVALUATION format on one set of towers
+        fn GadgetMul(matrix: &Matrix, base: i64, len: usize) -> Result<UniquePtr<Matrix>>;
+        fn GadgetMulTranspose(matrix: &Matrix, base: i64, len: usize) -> Result<UniquePtr<Matrix>>;
+    }
+
+    // MappedMatrix
+    unsafe extern "C++" {
+        // Opens a fixed-layout matrix file (see MatrixFile.h) without reading any element. File
+        // and index errors below come back as Err.
+        fn MappedMatrixOpen(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            path: &String,
+        ) -> Result<UniquePtr<MappedMatrix>>;
+        fn GetRows(self: &MappedMatrix) -> usize;
+        fn GetCols(self: &MappedMatrix) -> usize;
+        fn GetFormat(self: &MappedMatrix) -> Format;
+        // Borrowed from the mapping: all towers of one element, tower-major
+        fn GetElementValues(self: &MappedMatrix, row: usize, col: usize) -> Result<&[u64]>;
+        fn GetTowerValues(
+            self: &MappedMatrix,
+            row: usize,
+            col: usize,
+            tower_idx: usize,
+        ) -> Result<&[u64]>;
+        fn GetElement(self: &MappedMatrix, row: usize, col: usize) -> Result<UniquePtr<DCRTPoly>>;
+        fn GetColumn(self: &MappedMatrix, col: usize) -> Result<UniquePtr<Matrix>>;
+        fn ToMatrix(self: &MappedMatrix) -> Result<UniquePtr<Matrix>>;
+        // Writes the fixed layout read by MappedMatrixOpen and GetMatrixFromFs
+        fn MatrixWriteToFs(matrix: &Matrix, path: &String) -> Result<()>;
+        // Stores only the seed of a MatrixGenFromDugSeeded matrix; GetMatrixFromFs expands it
+        fn MatrixWriteSeededToFs(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            nrow: usize,
+            ncol: usize,
+            seed: &[u8],
+            stream: u64,
+            path: &String,
+        ) -> Result<()>;
+
+        // Streaming writer for the same layout; the file is sized up front
+        fn MatrixFileWriterOpen(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            path: &String,
+            rows: usize,
+            cols: usize,
+            format: Format,
+            sync: MatrixFileSync,
+        ) -> Result<UniquePtr<MatrixFileWriter>>;
+        fn WriteElement(
+            self: Pin<&mut MatrixFileWriter>,
+            row: usize,
+            col: usize,
+            element: &DCRTPoly,
+        ) -> Result<()>;
+        fn WriteColumn(self: Pin<&mut MatrixFileWriter>, col: usize, column: &Matrix)
+            -> Result<()>;
+        fn Finish(self: Pin<&mut MatrixFileWriter>) -> Result<()>;
+    }
+
+    // MatrixView
+    unsafe extern "C++" {
+        // The view keeps a plain pointer to `matrix`; use `MatrixSlice` for a lifetime-checked view.
+        unsafe fn MatrixViewGen(
+            matrix: &Matrix,
+            startRow: usize,
+            endRow: usize,
+            startCol: usize,
+            endCol: usize,
+        ) -> UniquePtr<MatrixView>;
+        fn GetRows(self: &MatrixView) -> usize;
+        fn GetCols(self: &MatrixView) -> usize;
+        unsafe fn GetElementRef(self: &MatrixView, row: usize, col: usize) -> UniquePtr<DCRTPoly>;
+        unsafe fn SubView(
+            self: &MatrixView,
+            startRow: usize,
+            endRow: usize,
+            startCol: usize,
+            endCol: usize,
+        ) -> UniquePtr<MatrixView>;
+        fn Materialize(self: &MatrixView) -> UniquePtr<Matrix>;
     }
 
     // KeyPairDCRTPoly
@@ -1669,6 +1922,15 @@ pub mod ffi {
             ciphertext: &CiphertextDCRTPoly,
             serialMode: SerialMode,
         ) -> bool;
+        fn DCRTPolyDeserializeCiphertextFromBytes(
+            data: &[u8],
+            ciphertext: Pin<&mut CiphertextDCRTPoly>,
+            serialMode: SerialMode,
+        ) -> bool;
+        fn DCRTPolySerializeCiphertextToBytes(
+            ciphertext: &CiphertextDCRTPoly,
+            serialMode: SerialMode,
+        ) -> Vec<u8>;
 
         // CryptoContextDCRTPoly
         fn DCRTPolyDeserializeCryptoContextFromFile(
@@ -1681,6 +1943,15 @@ pub mod ffi {
             cryptoContext: &CryptoContextDCRTPoly,
             serialMode: SerialMode,
         ) -> bool;
+        fn DCRTPolyDeserializeCryptoContextFromBytes(
+            data: &[u8],
+            cryptoContext: Pin<&mut CryptoContextDCRTPoly>,
+            serialMode: SerialMode,
+        ) -> bool;
+        fn DCRTPolySerializeCryptoContextToBytes(
+            cryptoContext: &CryptoContextDCRTPoly,
+            serialMode: SerialMode,
+        ) -> Vec<u8>;
 
         // EvalAutomorphismKey
         fn DCRTPolyDeserializeEvalAutomorphismKeyFromFile(
@@ -1750,6 +2021,15 @@ pub mod ffi {
             cryptoContext: &CryptoContextDCRTPoly,
             serialMode: SerialMode,
         ) -> bool;
+        fn DCRTPolyDeserializeEvalSumKeyFromBytes(data: &[u8], serialMode: SerialMode) -> bool;
+        fn DCRTPolySerializeEvalSumKeyByIdToBytes(
+            serialMode: SerialMode,
+            id: &CxxString,
+        ) -> Vec<u8>;
+        fn DCRTPolySerializeEvalSumKeyToBytes(
+            cryptoContext: &CryptoContextDCRTPoly,
+            serialMode: SerialMode,
+        ) -> Vec<u8>;
 
         // PublicKey
         fn DCRTPolyDeserializePublicKeyFromFile(
@@ -1762,6 +2042,15 @@ pub mod ffi {
             publicKey: &PublicKeyDCRTPoly,
             serialMode: SerialMode,
         ) -> bool;
+        fn DCRTPolyDeserializePublicKeyFromBytes(
+            data: &[u8],
+            publicKey: Pin<&mut PublicKeyDCRTPoly>,
+            serialMode: SerialMode,
+        ) -> bool;
+        fn DCRTPolySerializePublicKeyToBytes(
+            publicKey: &PublicKeyDCRTPoly,
+            serialMode: SerialMode,
+        ) -> Vec<u8>;
 
         // PrivateKey
         fn DCRTPolyDeserializePrivateKeyFromFile(
@@ -1774,6 +2063,39 @@ pub mod ffi {
             privateKey: &PrivateKeyDCRTPoly,
             serialMode: SerialMode,
         ) -> bool;
+        fn DCRTPolyDeserializePrivateKeyFromBytes(
+            data: &[u8],
+            privateKey: Pin<&mut PrivateKeyDCRTPoly>,
+            serialMode: SerialMode,
+        ) -> bool;
+        fn DCRTPolySerializePrivateKeyToBytes(
+            privateKey: &PrivateKeyDCRTPoly,
+            serialMode: SerialMode,
+        ) -> Vec<u8>;
+
+        // DCRTPoly, Matrix and RLWETrapdoorPair; deserialization returns null on malformed input
+        fn DCRTPolySerializeToBytes(poly: &DCRTPoly, serialMode: SerialMode) -> Vec<u8>;
+        fn DCRTPolyDeserializeFromBytes(data: &[u8], serialMode: SerialMode)
+            -> UniquePtr<DCRTPoly>;
+        fn MatrixSerializeToBytes(matrix: &Matrix, serialMode: SerialMode) -> Vec<u8>;
+        fn MatrixDeserializeFromBytes(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            data: &[u8],
+            serialMode: SerialMode,
+        ) -> UniquePtr<Matrix>;
+        fn RLWETrapdoorPairSerializeToBytes(
+            trapdoorPair: &RLWETrapdoorPair,
+            serialMode: SerialMode,
+        ) -> Vec<u8>;
+        fn RLWETrapdoorPairDeserializeFromBytes(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            data: &[u8],
+            serialMode: SerialMode,
+        ) -> UniquePtr<RLWETrapdoorPair>;
     }
 
     // Trapdoor
@@ -1785,6 +2107,17 @@ pub mod ffi {
             col: usize,
         ) -> UniquePtr<DCRTPoly>;
         fn GetTrapdoorPair(self: &DCRTTrapdoor) -> UniquePtr<RLWETrapdoorPair>;
+        // Borrowed views tied to the trapdoor's lifetime
+        fn GetPublicMatrixRef(self: &DCRTTrapdoor) -> &Matrix;
+        unsafe fn GetPublicMatrixElementRef(
+            self: &DCRTTrapdoor,
+            row: usize,
+            col: usize,
+        ) -> UniquePtr<DCRTPoly>;
+        fn GetTrapdoorPairRef(self: &DCRTTrapdoor) -> &RLWETrapdoorPair;
+        // Move-out accessors behind `DCRTTrapdoorIntoParts`; the trapdoor is left empty
+        fn TakePublicMatrix(self: Pin<&mut DCRTTrapdoor>) -> UniquePtr<Matrix>;
+        fn TakeTrapdoorPair(self: Pin<&mut DCRTTrapdoor>) -> UniquePtr<RLWETrapdoorPair>;
 
         // Generator functions
         fn DCRTTrapdoorGen(
@@ -1806,6 +2139,61 @@ pub mod ffi {
             balanced: bool,
         ) -> UniquePtr<DCRTTrapdoor>;
 
+        // Reproducible from a 32-byte seed and a stream id; errors on a bad seed, stddev or base
+        fn DCRTTrapdoorGenSeeded(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            stddev: f64,
+            base: i64,
+            balanced: bool,
+            seed: &[u8],
+            stream: u64,
+        ) -> Result<UniquePtr<DCRTTrapdoor>>;
+        fn DCRTSquareMatTrapdoorGenSeeded(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            d: usize,
+            stddev: f64,
+            base: i64,
+            balanced: bool,
+            seed: &[u8],
+            stream: u64,
+        ) -> Result<UniquePtr<DCRTTrapdoor>>;
+
+        // `count` trapdoors in parallel; an empty seed uses OpenFHE's PRNG, otherwise trapdoor i
+        // is the seeded one for stream first_stream + i. The first failure is returned as Err.
+        fn DCRTTrapdoorGenBatch(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            stddev: f64,
+            base: i64,
+            balanced: bool,
+            count: usize,
+            seed: &[u8],
+            first_stream: u64,
+        ) -> Result<UniquePtr<VectorOfDCRTTrapdoors>>;
+        fn DCRTSquareMatTrapdoorGenBatch(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            d: usize,
+            stddev: f64,
+            base: i64,
+            balanced: bool,
+            count: usize,
+            seed: &[u8],
+            first_stream: u64,
+        ) -> Result<UniquePtr<VectorOfDCRTTrapdoors>>;
+        fn GetSize(self: &VectorOfDCRTTrapdoors) -> usize;
+        fn GetElement(self: &VectorOfDCRTTrapdoors, index: usize) -> &DCRTTrapdoor;
+        fn TakeElement(
+            self: Pin<&mut VectorOfDCRTTrapdoors>,
+            index: usize,
+        ) -> UniquePtr<DCRTTrapdoor>;
+
         // Gauss sample functions
         fn DCRTTrapdoorGaussSamp(
             n: u32,
@@ -1817,6 +2205,76 @@ pub mod ffi {
             dgg_stddev: f64,
         ) -> UniquePtr<Matrix>;
 
+        // Samplers that keep the trapdoor-derived covariance and DGGs between calls; they copy
+        // the public matrix and trapdoor once, so neither needs to outlive the sampler
+        fn DCRTTrapdoorSamplerGen(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            public_matrix: &Matrix,
+            trapdoor: &RLWETrapdoorPair,
+            base: i64,
+            dgg_stddev: f64,
+        ) -> UniquePtr<DCRTTrapdoorSampler>;
+        fn DCRTSquareMatTrapdoorSamplerGen(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            public_matrix: &Matrix,
+            trapdoor: &RLWETrapdoorPair,
+            base: i64,
+            dgg_stddev: f64,
+        ) -> UniquePtr<DCRTTrapdoorSampler>;
+        fn Sample(self: Pin<&mut DCRTTrapdoorSampler>, u: &DCRTPoly) -> UniquePtr<Matrix>;
+        fn SampleSquareMat(self: Pin<&mut DCRTTrapdoorSampler>, U: &Matrix) -> UniquePtr<Matrix>;
+        fn IsSquare(self: &DCRTTrapdoorSampler) -> bool;
+
+        // Perturbations drawn ahead of time by `workers` background threads, at most `capacity`
+        fn DCRTPerturbationPoolGen(
+            n: u32,
+            size: usize,
+            k_res: usize,
+            public_matrix: &Matrix,
+            trapdoor: &RLWETrapdoorPair,
+            square: bool,
+            base: i64,
+            dgg_stddev: f64,
+            capacity: usize,
+            workers: usize,
+        ) -> UniquePtr<DCRTPerturbationPool>;
+        // Errors on the wrong trapdoor shape, or with a background worker's failure
+        fn Sample(self: Pin<&mut DCRTPerturbationPool>, u: &DCRTPoly) -> Result<UniquePtr<Matrix>>;
+        fn SampleSquareMat(
+            self: Pin<&mut DCRTPerturbationPool>,
+            U: &Matrix,
+        ) -> Result<UniquePtr<Matrix>>;
+        fn GetAvailable(self: &DCRTPerturbationPool) -> usize;
+
+        // One preimage per column of a 1 x count syndrome matrix, as the columns of the result
+        fn DCRTTrapdoorGaussSampBatch(
+            n: u32,
+            k: u32,
+            public_matrix: &Matrix,
+            trapdoor: &RLWETrapdoorPair,
+            syndromes: &Matrix,
+            base: i64,
+            dgg_stddev: f64,
+        ) -> UniquePtr<Matrix>;
+
+        // Streams each preimage column to a matrix file as soon as it is sampled
+        fn DCRTTrapdoorGaussSampBatchToFs(
+            n: u32,
+            k: u32,
+            public_matrix: &Matrix,
+            trapdoor: &RLWETrapdoorPair,
+            syndromes: &Matrix,
+            base: i64,
+            dgg_stddev: f64,
+            path: &String,
+            sync: MatrixFileSync,
+        ) -> Result<()>;
+
+        // Writes the fixed MatrixWriteToFs layout rather than cereal; GetMatrixFromFs reads both
         fn DCRTTrapdoorGaussSampToFs(
             n: u32,
             k: u32,
@@ -1826,7 +2284,7 @@ pub mod ffi {
             base: i64,
             dgg_stddev: f64,
             path: &String,
-        );
+        ) -> Result<()>;
 
         fn DCRTSquareMatTrapdoorGaussSamp(
             n: u32,
@@ -1847,9 +2305,22 @@ pub mod ffi {
             base: i64,
             dgg_stddev: f64,
             path: &String,
-        );
+        ) -> Result<()>;
 
         fn GenerateIntegerKarney(mean: f64, stddev: f64) -> i64;
+        // Errors on a non-finite mean or a stddev that is not positive and finite
+        fn GenerateIntegersKarney(mean: f64, stddev: f64, out: &mut [i64]) -> Result<()>;
+
+        // Table-based sampler for a fixed standard deviation in (0, 65536]; errors otherwise
+        fn DiscreteGaussianCDTGen(stddev: f64) -> Result<UniquePtr<DiscreteGaussianCDT>>;
+        fn GetStd(self: &DiscreteGaussianCDT) -> f64;
+        fn SampleInto(self: &DiscreteGaussianCDT, out: &mut [i64]);
+        fn SamplePoly(
+            self: &DiscreteGaussianCDT,
+            n: u32,
+            size: usize,
+            k_res: usize,
+        ) -> UniquePtr<DCRTPoly>;
 
         fn DCRTPolyGadgetVector(
             n: u32,
@@ -1870,6 +2341,19 @@ pub mod ffi {
             dgg_stddev: f64,
             tower_idx: usize,
         ) -> Vec<i64>;
+        // Every tower at once into `out`, laid out towers x k_res_digits x n; a tower count or
+        // `out` length that does not match is returned as an error
+        fn DCRTGaussSampGqArbBaseInto(
+            syndrome: &DCRTPoly,
+            c: f64,
+            n: u32,
+            size: usize,
+            k_res_bits: usize,
+            k_res_digits: usize,
+            base: i64,
+            dgg_stddev: f64,
+            out: &mut [i64],
+        ) -> Result<()>;
 
         fn SampleP1ForPertMat(
             a: &Matrix,
@@ -1884,11 +2368,16 @@ pub mod ffi {
             s: f64,
             dgg_stddev: f64,
         ) -> UniquePtr<Matrix>;
+        fn GetSampleP1Timings() -> SampleP1Timings;
+        fn ResetSampleP1Timings();
     }
 }
 
 use crate::ffi::DCRTPoly;
 use std::fmt;
+use std::marker::PhantomData;
+use std::ops::Range;
+use std::pin::Pin;
 
 impl fmt::Debug for DCRTPoly {
     fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
@@ -1902,6 +2391,143 @@ impl PartialEq for DCRTPoly {
     }
 }
 
+impl DCRTPoly {
+    /// Returns the coefficients as a flat little-endian `u64` limb buffer, `limbs_per_int`
+    /// limbs per coefficient, matching the layout of `pack_dcrtpoly_u64_limbs_le`.
+    ///
+    /// `limbs_per_int` must be large enough to hold the composite modulus.
+    pub fn GetCoefficientsLimbs(&self, limbs_per_int: usize) -> Vec<u64> {
+        let mut out = vec![0u64; self.GetRingDimension() * limbs_per_int];
+        self.WriteCoefficientsLimbsInto(limbs_per_int, &mut out);
+        out
+    }
+}
+
+/// Consumes a trapdoor and returns its public matrix and trapdoor pair without copying either.
+pub fn DCRTTrapdoorIntoParts(
+    mut trapdoor: cxx::UniquePtr<ffi::DCRTTrapdoor>,
+) -> (
+    cxx::UniquePtr<ffi::Matrix>,
+    cxx::UniquePtr<ffi::RLWETrapdoorPair>,
+) {
+    let public_matrix = trapdoor.pin_mut().TakePublicMatrix();
+    let trapdoor_pair = trapdoor.pin_mut().TakeTrapdoorPair();
+    (public_matrix, trapdoor_pair)
+}
+
+/// Read-only view of a poly owned by a `Matrix` or a trapdoor; the towers are not copied.
+pub struct DCRTPolyRef<'a> {
+    poly: cxx::UniquePtr<DCRTPoly>,
+    _owner: PhantomData<&'a DCRTPoly>,
+}
+
+impl std::ops::Deref for DCRTPolyRef<'_> {
+    type Target = DCRTPoly;
+
+    fn deref(&self) -> &DCRTPoly {
+        &self.poly
+    }
+}
+
+/// Mutable view of a poly owned by a `Matrix`; the towers are not copied.
+pub struct DCRTPolyMut<'a> {
+    poly: cxx::UniquePtr<DCRTPoly>,
+    _owner: PhantomData<&'a mut DCRTPoly>,
+}
+
+impl DCRTPolyMut<'_> {
+    pub fn pin_mut(&mut self) -> Pin<&mut DCRTPoly> {
+        self.poly.pin_mut()
+    }
+}
+
+impl std::ops::Deref for DCRTPolyMut<'_> {
+    type Target = DCRTPoly;
+
+    fn deref(&self) -> &DCRTPoly {
+        &self.poly
+    }
+}
+
+/// Borrows entry `(row, col)` of `matrix` in place.
+pub fn MatrixElementRef(matrix: &ffi::Matrix, row: usize, col: usize) -> DCRTPolyRef<'_> {
+    // SAFETY: the view is tied to the matrix borrow, so it cannot outlive the entry.
+    let poly = unsafe { ffi::GetMatrixElementRef(matrix, row, col) };
+    DCRTPolyRef {
+        poly,
+        _owner: PhantomData,
+    }
+}
+
+/// Mutably borrows entry `(row, col)` of `matrix` in place.
+pub fn MatrixElementMut(matrix: Pin<&mut ffi::Matrix>, row: usize, col: usize) -> DCRTPolyMut<'_> {
+    // SAFETY: the view holds the unique matrix borrow for as long as it lives.
+    let poly = unsafe { ffi::GetMatrixElementMut(matrix, row, col) };
+    DCRTPolyMut {
+        poly,
+        _owner: PhantomData,
+    }
+}
+
+/// Borrows entry `(row, col)` of the trapdoor's public matrix in place.
+pub fn DCRTTrapdoorPublicMatrixElementRef(
+    trapdoor: &ffi::DCRTTrapdoor,
+    row: usize,
+    col: usize,
+) -> DCRTPolyRef<'_> {
+    // SAFETY: the view is tied to the trapdoor borrow.
+    let poly = unsafe { trapdoor.GetPublicMatrixElementRef(row, col) };
+    DCRTPolyRef {
+        poly,
+        _owner: PhantomData,
+    }
+}
+
+/// Borrowed window `rows x cols` over a `Matrix`; entries are read in place, never copied.
+pub struct MatrixSlice<'a> {
+    view: cxx::UniquePtr<ffi::MatrixView>,
+    _matrix: PhantomData<&'a ffi::Matrix>,
+}
+
+impl<'a> MatrixSlice<'a> {
+    pub fn new(matrix: &'a ffi::Matrix, rows: Range<usize>, cols: Range<usize>) -> Self {
+        // SAFETY: the view is tied to `'a`, so it cannot outlive the matrix it points into.
+        let view =
+            unsafe { ffi::MatrixViewGen(matrix, rows.start, rows.end, cols.start, cols.end) };
+        MatrixSlice {
+            view,
+            _matrix: PhantomData,
+        }
+    }
+
+    /// Narrows this slice; ranges are relative to the slice.
+    pub fn slice(&self, rows: Range<usize>, cols: Range<usize>) -> MatrixSlice<'a> {
+        // SAFETY: the sub-view points into the same `'a` matrix.
+        let view = unsafe {
+            self.view
+                .SubView(rows.start, rows.end, cols.start, cols.end)
+        };
+        MatrixSlice {
+            view,
+            _matrix: PhantomData,
+        }
+    }
+
+    pub fn view(&self) -> &ffi::MatrixView {
+        &self.view
+    }
+
+    /// Borrows entry `(row, col)` of the slice in place.
+    pub fn element(&self, row: usize, col: usize) -> DCRTPolyRef<'a> {
+        // SAFETY: the entry lives in the same `'a` matrix as the view.
+        let poly = unsafe { self.view.GetElementRef(row, col) };
+        DCRTPolyRef {
+            poly,
+            _owner: PhantomData,
+        }
+    }
+}
+
 pub struct ParsedCoefficients {
     pub coefficients: Vec<BigUint>,
     pub modulus: BigUint,
@@ -2044,6 +2670,46 @@ mod tests {
         LOCK.get_or_init(|| Mutex::new(()))
     }
 
+    const TEST_SIGMA: f64 = 4.57825;
+
+    // Bit length of the composite modulus, the `k` the Gauss samplers expect for base 2
+    fn modulus_bits(n: u32, size: usize, k_res: usize) -> u32 {
+        let modulus = ffi::DCRTPolyGenFromDug(n, size, k_res).GetModulus();
+        BigUint::parse_bytes(modulus.as_bytes(), 10).unwrap().bits() as u32
+    }
+
+    fn random_matrix(
+        n: u32,
+        size: usize,
+        k_res: usize,
+        rows: usize,
+        cols: usize,
+    ) -> cxx::UniquePtr<ffi::Matrix> {
+        let mut matrix = ffi::MatrixGen(n, size, k_res, rows, cols);
+        for i in 0..rows {
+            for j in 0..cols {
+                let poly = ffi::DCRTPolyGenFromDug(n, size, k_res);
+                ffi::SetMatrixElement(matrix.pin_mut(), i, j, &poly);
+            }
+        }
+        matrix
+    }
+
+    // Asserts public_matrix * preimage == target entry by entry
+    fn assert_preimage(public_matrix: &ffi::Matrix, preimage: &ffi::Matrix, target: &ffi::Matrix) {
+        let product = ffi::MatrixMul(public_matrix, preimage).unwrap();
+        assert_eq!(ffi::GetMatrixRows(&product), ffi::GetMatrixRows(target));
+        assert_eq!(ffi::GetMatrixCols(&product), ffi::GetMatrixCols(target));
+        for i in 0..ffi::GetMatrixRows(target) {
+            for j in 0..ffi::GetMatrixCols(target) {
+                assert_eq!(
+                    &*MatrixElementRef(&product, i, j),
+                    &*MatrixElementRef(target, i, j)
+                );
+            }
+        }
+    }
+
     // TODO: add more tests
     #[test]
     fn SimpleIntegersExample() {
@@ -2476,6 +3142,21 @@ mod tests {
         print!("\n Evaluation time: {:.0?}\n", _time_eval_poly_2);
     }
 
+    #[test]
+    fn ParamsCache_shares_and_clears() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let (n, size, k_res) = (8u32, 2usize, 30usize);
+
+        let first = ffi::DCRTPolyGenCRTBasis(n, size, k_res);
+        let second = ffi::DCRTPolyGenCRTBasis(n, size, k_res);
+        assert!(std::ptr::eq(&*first, &*second));
+
+        ffi::DCRTPolyClearParamsCache();
+        let rebuilt = ffi::DCRTPolyGenCRTBasis(n, size, k_res);
+        assert!(!std::ptr::eq(&*first, &*rebuilt));
+        assert_eq!(first.GetModuli(), rebuilt.GetModuli());
+    }
+
     #[test]
     fn DCRTPolyGenFromEvalVec_slot_selection() {
         let _guard = openfhe_test_lock().lock().unwrap();
@@ -2518,4 +3199,1300 @@ mod tests {
             );
         }
     }
+
+    #[test]
+    fn DCRTPolyGenFromRnsVec_matches_limbs() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 3;
+        let k_res: usize = 24;
+
+        // Two-limb values so every tower has to fold in 2^64 mod q
+        let mut limbs: Vec<u64> = Vec::with_capacity(2 * n as usize);
+        for i in 0..(n as u64) {
+            limbs.push(i.wrapping_mul(0x9E37_79B9_7F4A_7C15));
+            limbs.push(i * 31 + 7);
+        }
+        let from_limbs = ffi::DCRTPolyGenFromVec(n, size, k_res, &limbs, 2);
+
+        let mut residues: Vec<u64> = Vec::with_capacity(size * n as usize);
+        let basis = ffi::DCRTPolyGenCRTBasis(n, size, k_res);
+        for &q in basis.GetModuli() {
+            let q = q as u128;
+            for i in 0..(n as usize) {
+                let value = (limbs[2 * i + 1] as u128) << 64 | limbs[2 * i] as u128;
+                residues.push((value % q) as u64);
+            }
+        }
+        let from_rns = ffi::DCRTPolyGenFromRnsVec(n, size, k_res, &residues);
+
+        assert_eq!(from_limbs, from_rns);
+    }
+
+    #[test]
+    fn DCRTPolyGetCoefficientsLimbs_roundtrip() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 3;
+        let k_res: usize = 24;
+
+        let modulus: BigUint = ffi::GenModulus(n, size, k_res).parse().unwrap();
+        let mut limbs: Vec<u64> = Vec::with_capacity(3 * n as usize);
+        let mut expected: Vec<u64> = Vec::with_capacity(3 * n as usize);
+        for i in 0..(n as u64) {
+            let value = BigUint::from(i.wrapping_mul(0x9E37_79B9_7F4A_7C15)) << 64u32
+                | BigUint::from(i * 31 + 7);
+            let mut value_limbs = value.to_u64_digits();
+            value_limbs.resize(3, 0);
+            limbs.extend_from_slice(&value_limbs);
+
+            let mut reduced = (value % &modulus).to_u64_digits();
+            reduced.resize(3, 0);
+            expected.extend_from_slice(&reduced);
+        }
+
+        // GenFromVec stores evaluation form, so this also covers the conversion back
+        let poly = ffi::DCRTPolyGenFromVec(n, size, k_res, &limbs, 3);
+        assert_eq!(poly.GetCoefficientsLimbs(3), expected);
+    }
+
+    #[test]
+    fn DCRTPolyInPlaceArithmetic() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+
+        let a_vals: Vec<u64> = (0..n as u64).map(|i| 3 * i + 1).collect();
+        let b_vals: Vec<u64> = (0..n as u64).map(|i| i * i + 5).collect();
+        let a = ffi::DCRTPolyGenFromVec(n, size, k_res, &a_vals, 1);
+        let b = ffi::DCRTPolyGenFromVec(n, size, k_res, &b_vals, 1);
+
+        let mut acc = ffi::DCRTPolyGenFromVec(n, size, k_res, &a_vals, 1);
+        acc.pin_mut().AddAssign(&b).unwrap();
+        assert_eq!(acc, ffi::DCRTPolyAdd(&a, &b));
+        acc.pin_mut().SubAssign(&b).unwrap();
+        assert_eq!(acc, a);
+        assert_eq!(ffi::DCRTPolySub(&ffi::DCRTPolyAdd(&a, &b), &b), a);
+
+        acc.pin_mut().MulAssign(&b).unwrap();
+        let product = ffi::DCRTPolyMul(&a, &b);
+        assert_eq!(acc, product);
+
+        let mut fused = ffi::DCRTPolyGenFromVec(n, size, k_res, &b_vals, 1);
+        ffi::DCRTPolyMulAdd(fused.pin_mut(), &a, &b).unwrap();
+        assert_eq!(fused, ffi::DCRTPolyAdd(&product, &b));
+
+        acc.pin_mut().ScalarMulAssign(7);
+        assert_eq!(acc, ffi::DCRTPolyScalarMulLimbs(&product, &[7, 0]));
+        assert_eq!(acc, ffi::DCRTPolyScalarMul(&product, 7));
+
+        // same ring and tower count, different primes
+        let other = ffi::DCRTPolyGenFromVec(n, size, k_res + 1, &b_vals, 1);
+        assert!(acc.pin_mut().AddAssign(&other).is_err());
+        assert!(acc.pin_mut().SubAssign(&other).is_err());
+        assert!(acc.pin_mut().MulAssign(&other).is_err());
+        assert!(ffi::DCRTPolyMulAdd(fused.pin_mut(), &a, &other).is_err());
+        let fewer = ffi::DCRTPolyGenFromVec(n, size - 1, k_res, &b_vals, 1);
+        assert!(ffi::DCRTPolyMulAdd(fused.pin_mut(), &fewer, &b).is_err());
+    }
+
+    #[test]
+    fn MatrixMul_matches_elementwise() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+
+        let mut a = ffi::MatrixGen(n, size, k_res, 2, 3);
+        let mut b = ffi::MatrixGen(n, size, k_res, 3, 2);
+        for i in 0..3 {
+            for j in 0..2 {
+                let vals: Vec<u64> = (0..n as u64).map(|x| x + 10 * i + j).collect();
+                let poly = ffi::DCRTPolyGenFromVec(n, size, k_res, &vals, 1);
+                ffi::SetMatrixElement(a.pin_mut(), j as usize, i as usize, &poly);
+                let vals: Vec<u64> = (0..n as u64).map(|x| 3 * x + i + 7 * j).collect();
+                let poly = ffi::DCRTPolyGenFromVec(n, size, k_res, &vals, 1);
+                ffi::SetMatrixElement(b.pin_mut(), i as usize, j as usize, &poly);
+            }
+        }
+
+        let product = ffi::MatrixMul(&a, &b).unwrap();
+        for i in 0..2 {
+            for j in 0..2 {
+                let mut expected = ffi::DCRTPolyGenFromConst(n, size, k_res, &[0]);
+                for k in 0..3 {
+                    ffi::DCRTPolyMulAdd(
+                        expected.pin_mut(),
+                        &ffi::GetMatrixElement(&a, i, k),
+                        &ffi::GetMatrixElement(&b, k, j),
+                    )
+                    .unwrap();
+                }
+                assert_eq!(ffi::GetMatrixElement(&product, i, j), expected);
+            }
+        }
+
+        let mut acc = ffi::MatrixAdd(&product, &product).unwrap();
+        ffi::MatrixMulAccumulate(acc.pin_mut(), &a, &b).unwrap();
+        let tripled = ffi::MatrixAdd(&acc, &ffi::MatrixSub(&product, &product).unwrap()).unwrap();
+        let three = ffi::DCRTPolyGenFromConst(n, size, k_res, &[3]);
+        assert_eq!(
+            ffi::GetMatrixElement(&tripled, 1, 1),
+            ffi::GetMatrixElement(&ffi::MatrixScalarMul(&product, &three).unwrap(), 1, 1)
+        );
+
+        // one entry on other primes, one with fewer towers: rejected before any tower is read
+        let other = ffi::DCRTPolyGenFromConst(n, size, k_res + 1, &[3]);
+        let fewer = ffi::DCRTPolyGenFromConst(n, size - 1, k_res, &[3]);
+        for odd in [&other, &fewer] {
+            let mut mixed = ffi::ExtractMatrixRows(&a, 0, 1);
+            ffi::SetMatrixElement(mixed.pin_mut(), 1, 2, odd);
+            assert!(ffi::MatrixMul(&mixed, &b).is_err());
+            assert!(ffi::MatrixMul(&b, &mixed).is_err());
+            assert!(ffi::MatrixAdd(&mixed, &a).is_err());
+            assert!(ffi::MatrixSub(&a, &mixed).is_err());
+            assert!(ffi::MatrixScalarMul(&a, odd).is_err());
+
+            let mut mixed_acc = ffi::MatrixAdd(&product, &product).unwrap();
+            ffi::SetMatrixElement(mixed_acc.pin_mut(), 0, 1, odd);
+            assert!(ffi::MatrixMulAccumulate(mixed_acc.pin_mut(), &a, &b).is_err());
+        }
+    }
+
+    #[test]
+    fn MatrixElementViews() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+
+        let vals: Vec<u64> = (0..n as u64).map(|x| 5 * x + 1).collect();
+        let mut matrix = ffi::MatrixGen(n, size, k_res, 2, 2);
+        let poly = ffi::DCRTPolyGenFromVec(n, size, k_res, &vals, 1);
+        let copy = ffi::DCRTPolyGenFromVec(n, size, k_res, &vals, 1);
+        ffi::SetMatrixElementOwned(matrix.pin_mut(), 0, 1, poly);
+        assert_eq!(&*MatrixElementRef(&matrix, 0, 1), &*copy);
+
+        MatrixElementMut(matrix.pin_mut(), 0, 1)
+            .pin_mut()
+            .AddAssign(&copy)
+            .unwrap();
+        assert_eq!(
+            &*MatrixElementRef(&matrix, 0, 1),
+            &*ffi::DCRTPolyAdd(&copy, &copy)
+        );
+    }
+
+    #[test]
+    fn MatrixSlice_matches_extract() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+
+        let mut matrix = ffi::MatrixGen(n, size, k_res, 2, 4);
+        for j in 0..4u64 {
+            let vals: Vec<u64> = (0..n as u64).map(|x| x + 3 * j).collect();
+            let poly = ffi::DCRTPolyGenFromVec(n, size, k_res, &vals, 1);
+            ffi::SetMatrixElement(matrix.pin_mut(), (j % 2) as usize, j as usize, &poly);
+        }
+
+        let extracted = ffi::ExtractMatrixCols(&matrix, 1, 3);
+        assert_eq!(ffi::GetMatrixCols(&extracted), 2);
+        let slice = MatrixSlice::new(&matrix, 0..2, 1..4).slice(0..2, 0..2);
+        for i in 0..2 {
+            for j in 0..2 {
+                assert_eq!(&*slice.element(i, j), &*MatrixElementRef(&extracted, i, j));
+            }
+        }
+
+        let row = MatrixSlice::new(&matrix, 0..1, 0..2);
+        let col = MatrixSlice::new(&matrix, 0..2, 1..2);
+        let product = ffi::MatrixViewMul(row.view(), col.view()).unwrap();
+        let expected =
+            ffi::MatrixMul(&row.view().Materialize(), &col.view().Materialize()).unwrap();
+        assert_eq!(
+            &*MatrixElementRef(&product, 0, 0),
+            &*MatrixElementRef(&expected, 0, 0)
+        );
+    }
+
+    #[test]
+    fn ExtractMatrix_ranges() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+
+        let mut matrix = ffi::MatrixGen(n, size, k_res, 3, 3);
+        for i in 0..3u64 {
+            for j in 0..3u64 {
+                let vals: Vec<u64> = (0..n as u64).map(|x| x + 3 * i + 7 * j).collect();
+                let poly = ffi::DCRTPolyGenFromVec(n, size, k_res, &vals, 1);
+                ffi::SetMatrixElement(matrix.pin_mut(), i as usize, j as usize, &poly);
+            }
+        }
+
+        // An empty column range still yields the start column
+        let single = ffi::ExtractMatrixCols(&matrix, 2, 2);
+        assert_eq!(ffi::GetMatrixCols(&single), 1);
+        let col = ffi::ExtractMatrixCol(&matrix, 2);
+        for i in 0..3 {
+            assert_eq!(
+                &*MatrixElementRef(&single, i, 0),
+                &*MatrixElementRef(&col, i, 0)
+            );
+            assert_eq!(
+                &*MatrixElementRef(&col, i, 0),
+                &*MatrixElementRef(&matrix, i, 2)
+            );
+        }
+
+        // Row ranges include the end row
+        let rows = ffi::ExtractMatrixRows(&matrix, 1, 2);
+        assert_eq!(ffi::GetMatrixRows(&rows), 2);
+        for i in 0..2 {
+            let row = ffi::ExtractMatrixRow(&matrix, i + 1);
+            for j in 0..3 {
+                assert_eq!(
+                    &*MatrixElementRef(&rows, i, j),
+                    &*MatrixElementRef(&row, 0, j)
+                );
+                assert_eq!(
+                    &*MatrixElementRef(&row, 0, j),
+                    &*MatrixElementRef(&matrix, i + 1, j)
+                );
+            }
+        }
+    }
+
+    #[test]
+    fn FormatMatrix_roundtrip() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 3;
+        let k_res: usize = 24;
+
+        let mut matrix = ffi::MatrixGen(n, size, k_res, 2, 2);
+        let vals: Vec<u64> = (0..n as u64).map(|x| 7 * x + 2).collect();
+        let mut poly = ffi::DCRTPolyGenFromVec(n, size, k_res, &vals, 1);
+        ffi::SetMatrixElement(matrix.pin_mut(), 1, 0, &poly);
+
+        ffi::FormatMatrix(matrix.pin_mut(), ffi::Format::COEFFICIENT);
+        poly.pin_mut().SetFormat(ffi::Format::COEFFICIENT);
+        assert!(poly.GetFormat() == ffi::Format::COEFFICIENT);
+        assert_eq!(&*MatrixElementRef(&matrix, 1, 0), &*poly);
+        assert_eq!(poly.GetTowerValues(0)[3], 23);
+
+        ffi::FormatMatrix(matrix.pin_mut(), ffi::Format::EVALUATION);
+        poly.pin_mut().SetFormat(ffi::Format::EVALUATION);
+        assert_eq!(&*MatrixElementRef(&matrix, 1, 0), &*poly);
+    }
+
+    #[test]
+    fn FormatMatrix_mixed_towers() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let k_res: usize = 30;
+
+        let vals: Vec<u64> = (0..n as u64).map(|x| 3 * x + 5).collect();
+        let mut matrix = ffi::MatrixGen(n, 2, k_res, 1, 2);
+        let narrow = ffi::DCRTPolyGenFromVec(n, 2, k_res, &vals, 1);
+        let wide = ffi::DCRTPolyGenFromVec(n, 3, k_res, &vals, 1);
+        ffi::SetMatrixElement(matrix.pin_mut(), 0, 0, &narrow);
+        ffi::SetMatrixElement(matrix.pin_mut(), 0, 1, &wide);
+
+        ffi::FormatMatrix(matrix.pin_mut(), ffi::Format::COEFFICIENT);
+        for (col, expected) in [(0, narrow), (1, wide)] {
+            let mut expected = expected;
+            expected.pin_mut().SetFormat(ffi::Format::COEFFICIENT);
+            assert_eq!(&*MatrixElementRef(&matrix, 0, col), &*expected);
+        }
+    }
+
+    #[test]
+    fn MappedMatrix_roundtrip() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+
+        let mut matrix = ffi::MatrixGen(n, size, k_res, 2, 3);
+        for j in 0..3u64 {
+            let vals: Vec<u64> = (0..n as u64).map(|x| 11 * x + j).collect();
+            let poly = ffi::DCRTPolyGenFromVec(n, size, k_res, &vals, 1);
+            ffi::SetMatrixElement(matrix.pin_mut(), 1, j as usize, &poly);
+        }
+
+        let path = std::env::temp_dir()
+            .join(format!("openfhe-mapped-matrix-{}.bin", std::process::id()))
+            .to_string_lossy()
+            .into_owned();
+        ffi::MatrixWriteToFs(&matrix, &path).unwrap();
+
+        let mapped = ffi::MappedMatrixOpen(n, size, k_res, &path).unwrap();
+        assert_eq!((mapped.GetRows(), mapped.GetCols()), (2, 3));
+        let element = MatrixElementRef(&matrix, 1, 2);
+        assert_eq!(
+            mapped.GetTowerValues(1, 2, 1).unwrap(),
+            element.GetTowerValues(1)
+        );
+        assert_eq!(&*mapped.GetElement(1, 2).unwrap(), &*element);
+        assert_eq!(
+            &*MatrixElementRef(&mapped.GetColumn(1).unwrap(), 1, 0),
+            &*MatrixElementRef(&matrix, 1, 1)
+        );
+        assert!(mapped.GetElementValues(2, 0).is_err());
+        assert!(mapped.GetTowerValues(0, 0, size).is_err());
+        assert!(mapped.GetElement(0, 3).is_err());
+        assert!(mapped.GetColumn(3).is_err());
+
+        let loaded = ffi::GetMatrixFromFs(n, size, k_res, &path).unwrap();
+        assert_eq!(
+            &*MatrixElementRef(&loaded, 1, 0),
+            &*MatrixElementRef(&matrix, 1, 0)
+        );
+        drop(mapped);
+
+        // missing, truncated and foreign files are errors, not aborts
+        let bytes = std::fs::read(&path).unwrap();
+        std::fs::write(&path, &bytes[..bytes.len() - 8]).unwrap();
+        assert!(ffi::MappedMatrixOpen(n, size, k_res, &path).is_err());
+        std::fs::write(&path, b"not a matrix file").unwrap();
+        assert!(ffi::MappedMatrixOpen(n, size, k_res, &path).is_err());
+        assert!(ffi::GetMatrixFromFs(n, size, k_res, &path).is_err());
+        std::fs::remove_file(&path).unwrap();
+        assert!(ffi::MappedMatrixOpen(n, size, k_res, &path).is_err());
+        assert!(ffi::GetMatrixFromFs(n, size, k_res, &path).is_err());
+
+        // the writer refuses elements built on other primes
+        let mut writer = ffi::MatrixFileWriterOpen(
+            n,
+            size,
+            k_res,
+            &path,
+            1,
+            1,
+            ffi::Format::EVALUATION,
+            ffi::MatrixFileSync::SYNC_NONE,
+        )
+        .unwrap();
+        let other = ffi::DCRTPolyGenFromDug(n, size, k_res + 1);
+        assert!(writer.pin_mut().WriteElement(0, 0, &other).is_err());
+        assert!(writer.pin_mut().WriteElement(1, 0, &element).is_err());
+        writer.pin_mut().WriteElement(0, 0, &element).unwrap();
+        writer.pin_mut().Finish().unwrap();
+        assert!(writer.pin_mut().WriteElement(0, 0, &element).is_err());
+        std::fs::remove_file(&path).unwrap();
+    }
+
+    #[test]
+    fn DCRTTrapdoorGaussSampBatch_preimages() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let base: i64 = 2;
+        let k = modulus_bits(n, size, k_res);
+
+        let trapdoor = ffi::DCRTTrapdoorGen(n, size, k_res, TEST_SIGMA, base, false);
+        let public_matrix = trapdoor.GetPublicMatrixRef();
+        let syndromes = random_matrix(n, size, k_res, 1, 3);
+        let preimages = ffi::DCRTTrapdoorGaussSampBatch(
+            n,
+            k,
+            public_matrix,
+            trapdoor.GetTrapdoorPairRef(),
+            &syndromes,
+            base,
+            TEST_SIGMA,
+        );
+        assert_eq!(ffi::GetMatrixCols(&preimages), 3);
+        for j in 0..3 {
+            assert_preimage(
+                public_matrix,
+                &ffi::ExtractMatrixCol(&preimages, j),
+                &ffi::ExtractMatrixCol(&syndromes, j),
+            );
+        }
+    }
+
+    #[test]
+    fn DCRTTrapdoorSampler_preimages() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let base: i64 = 2;
+
+        let trapdoor = ffi::DCRTTrapdoorGen(n, size, k_res, TEST_SIGMA, base, false);
+        let public_matrix = trapdoor.GetPublicMatrixRef();
+        let mut sampler = ffi::DCRTTrapdoorSamplerGen(
+            n,
+            size,
+            k_res,
+            public_matrix,
+            trapdoor.GetTrapdoorPairRef(),
+            base,
+            TEST_SIGMA,
+        );
+        assert!(!sampler.IsSquare());
+        let target = random_matrix(n, size, k_res, 1, 1);
+        for _ in 0..2 {
+            let preimage = sampler.pin_mut().Sample(&MatrixElementRef(&target, 0, 0));
+            assert_preimage(public_matrix, &preimage, &target);
+        }
+
+        let d: usize = 2;
+        let trapdoor = ffi::DCRTSquareMatTrapdoorGen(n, size, k_res, d, TEST_SIGMA, base, false);
+        let public_matrix = trapdoor.GetPublicMatrixRef();
+        let mut sampler = ffi::DCRTSquareMatTrapdoorSamplerGen(
+            n,
+            size,
+            k_res,
+            public_matrix,
+            trapdoor.GetTrapdoorPairRef(),
+            base,
+            TEST_SIGMA,
+        );
+        assert!(sampler.IsSquare());
+        let target = random_matrix(n, size, k_res, d, d);
+        let preimage = sampler.pin_mut().SampleSquareMat(&target);
+        assert_preimage(public_matrix, &preimage, &target);
+    }
+
+    #[test]
+    fn DCRTTrapdoorIntoParts_preimage() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let base: i64 = 2;
+        let k = modulus_bits(n, size, k_res);
+
+        let trapdoor = ffi::DCRTTrapdoorGen(n, size, k_res, TEST_SIGMA, base, false);
+        let expected = trapdoor.GetPublicMatrix();
+        let (public_matrix, trapdoor_pair) = DCRTTrapdoorIntoParts(trapdoor);
+        assert!(!public_matrix.is_null());
+        assert!(!trapdoor_pair.is_null());
+        assert_eq!(
+            ffi::GetMatrixRows(&public_matrix),
+            ffi::GetMatrixRows(&expected)
+        );
+        assert_eq!(
+            ffi::GetMatrixCols(&public_matrix),
+            ffi::GetMatrixCols(&expected)
+        );
+        for j in 0..ffi::GetMatrixCols(&expected) {
+            assert_eq!(
+                &*MatrixElementRef(&public_matrix, 0, j),
+                &*MatrixElementRef(&expected, 0, j)
+            );
+        }
+
+        let target = random_matrix(n, size, k_res, 1, 1);
+        let preimage = ffi::DCRTTrapdoorGaussSamp(
+            n,
+            k,
+            &public_matrix,
+            &trapdoor_pair,
+            &MatrixElementRef(&target, 0, 0),
+            base,
+            TEST_SIGMA,
+        );
+        assert_preimage(&public_matrix, &preimage, &target);
+    }
+
+    #[test]
+    fn DCRTPerturbationPool_preimages() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let base: i64 = 2;
+
+        let trapdoor = ffi::DCRTTrapdoorGen(n, size, k_res, TEST_SIGMA, base, false);
+        let public_matrix = trapdoor.GetPublicMatrixRef();
+        let mut pool = ffi::DCRTPerturbationPoolGen(
+            n,
+            size,
+            k_res,
+            public_matrix,
+            trapdoor.GetTrapdoorPairRef(),
+            false,
+            base,
+            TEST_SIGMA,
+            2,
+            2,
+        );
+        // More samples than the pool holds, so some wait on the workers
+        for _ in 0..4 {
+            let target = random_matrix(n, size, k_res, 1, 1);
+            let preimage = pool
+                .pin_mut()
+                .Sample(&MatrixElementRef(&target, 0, 0))
+                .unwrap();
+            assert_preimage(public_matrix, &preimage, &target);
+        }
+        assert!(pool.GetAvailable() <= 2 + 2);
+        let square_target = random_matrix(n, size, k_res, 2, 2);
+        assert!(pool.pin_mut().SampleSquareMat(&square_target).is_err());
+
+        let d: usize = 2;
+        let trapdoor = ffi::DCRTSquareMatTrapdoorGen(n, size, k_res, d, TEST_SIGMA, base, false);
+        let public_matrix = trapdoor.GetPublicMatrixRef();
+        let mut pool = ffi::DCRTPerturbationPoolGen(
+            n,
+            size,
+            k_res,
+            public_matrix,
+            trapdoor.GetTrapdoorPairRef(),
+            true,
+            base,
+            TEST_SIGMA,
+            1,
+            1,
+        );
+        let target = random_matrix(n, size, k_res, d, d);
+        let preimage = pool.pin_mut().SampleSquareMat(&target).unwrap();
+        assert_preimage(public_matrix, &preimage, &target);
+        assert!(pool
+            .pin_mut()
+            .Sample(&MatrixElementRef(&target, 0, 0))
+            .is_err());
+    }
+
+    #[test]
+    fn SampleP1ForPertMat_shape_format_and_timings() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let d: usize = 2;
+        let ncol: usize = 3;
+        let s: f64 = 100.0;
+
+        // Zero blocks and centre, so the covariance is s^2 I and every coefficient is a small
+        // centred Gaussian
+        let zero = ffi::MatrixGen(n, size, k_res, d, d);
+        let tp2 = ffi::MatrixGen(n, size, k_res, 2 * d, ncol);
+        let modulus = BigUint::parse_bytes(
+            ffi::DCRTPolyGenFromDug(n, size, k_res)
+                .GetModulus()
+                .as_bytes(),
+            10,
+        )
+        .unwrap();
+        let bound = BigUint::from((30.0 * s) as u64);
+
+        ffi::ResetSampleP1Timings();
+        let timings = ffi::GetSampleP1Timings();
+        assert_eq!(timings.calls, 0);
+        assert_eq!(
+            timings.covariance_ns + timings.center_ns + timings.sample_ns + timings.assemble_ns,
+            0
+        );
+
+        for _ in 0..2 {
+            let p1 = ffi::SampleP1ForPertMat(
+                &zero, &zero, &zero, &tp2, n, size, k_res, ncol, TEST_SIGMA, s, TEST_SIGMA,
+            );
+            assert_eq!(ffi::GetMatrixRows(&p1), 2 * d);
+            assert_eq!(ffi::GetMatrixCols(&p1), ncol);
+            for i in 0..2 * d {
+                for j in 0..ncol {
+                    let entry = MatrixElementRef(&p1, i, j);
+                    assert!(entry.GetFormat() == ffi::Format::EVALUATION);
+                    for coeff in entry.GetCoefficients() {
+                        let c = BigUint::parse_bytes(coeff.as_bytes(), 10).unwrap();
+                        let centred = if &c + &c > modulus { &modulus - &c } else { c };
+                        assert!(centred < bound);
+                    }
+                }
+            }
+        }
+
+        let timings = ffi::GetSampleP1Timings();
+        assert_eq!(timings.calls, 2);
+        assert!(timings.sample_ns > 0);
+        ffi::ResetSampleP1Timings();
+        let timings = ffi::GetSampleP1Timings();
+        assert_eq!(timings.calls, 0);
+        assert_eq!(
+            timings.covariance_ns + timings.center_ns + timings.sample_ns + timings.assemble_ns,
+            0
+        );
+    }
+
+    #[test]
+    fn DCRTSquareMatTrapdoorGaussSampToFs_streams_preimage() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let base: i64 = 2;
+        let d: usize = 2;
+        let k = modulus_bits(n, size, k_res);
+
+        let trapdoor = ffi::DCRTSquareMatTrapdoorGen(n, size, k_res, d, TEST_SIGMA, base, false);
+        let public_matrix = trapdoor.GetPublicMatrixRef();
+        let target = random_matrix(n, size, k_res, d, d);
+        let path = std::env::temp_dir()
+            .join(format!(
+                "openfhe-square-preimage-{}.bin",
+                std::process::id()
+            ))
+            .to_string_lossy()
+            .into_owned();
+        ffi::DCRTSquareMatTrapdoorGaussSampToFs(
+            n,
+            k,
+            public_matrix,
+            trapdoor.GetTrapdoorPairRef(),
+            &target,
+            base,
+            TEST_SIGMA,
+            &path,
+        )
+        .unwrap();
+
+        let preimage = ffi::GetMatrixFromFs(n, size, k_res, &path).unwrap();
+        assert_preimage(public_matrix, &preimage, &target);
+        std::fs::remove_file(&path).unwrap();
+    }
+
+    #[test]
+    fn DCRTGaussSampGqArbBaseInto_recomposes() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let ring = n as usize;
+
+        let syndrome = ffi::DCRTPolyGenFromDug(n, size, k_res);
+        let mut residues = vec![0u64; size * ring];
+        syndrome.WriteTowersInto(ffi::Format::COEFFICIENT, &mut residues);
+        let basis = ffi::DCRTPolyGenCRTBasis(n, size, k_res);
+
+        // base 2 with one digit per modulus bit, and base 8 with three bits per digit
+        for (base, digits) in [(2i64, k_res), (8i64, (k_res + 2) / 3)] {
+            let c = (base + 1) as f64 * TEST_SIGMA;
+            let mut out = vec![0i64; size * digits * ring];
+            ffi::DCRTGaussSampGqArbBaseInto(
+                &syndrome, c, n, size, k_res, digits, base, TEST_SIGMA, &mut out,
+            )
+            .unwrap();
+            for (t, &q) in basis.GetModuli().iter().enumerate() {
+                let tower = &out[t * digits * ring..(t + 1) * digits * ring];
+                for x in 0..ring {
+                    let mut sum: i128 = 0;
+                    let mut power: i128 = 1;
+                    for i in 0..digits {
+                        sum += power * tower[i * ring + x] as i128;
+                        power *= base as i128;
+                    }
+                    assert_eq!(sum.rem_euclid(q as i128), residues[t * ring + x] as i128);
+                }
+            }
+        }
+
+        let c = 3.0 * TEST_SIGMA;
+        let mut short = vec![0i64; size * k_res * ring - 1];
+        assert!(ffi::DCRTGaussSampGqArbBaseInto(
+            &syndrome, c, n, size, k_res, k_res, 2, TEST_SIGMA, &mut short,
+        )
+        .is_err());
+        let wide = ffi::DCRTPolyGenFromDug(n, size + 1, k_res);
+        let mut out = vec![0i64; size * k_res * ring];
+        assert!(ffi::DCRTGaussSampGqArbBaseInto(
+            &wide, c, n, size, k_res, k_res, 2, TEST_SIGMA, &mut out,
+        )
+        .is_err());
+    }
+
+    // Sample mean and variance of `samples`
+    fn moments(samples: &[i64]) -> (f64, f64) {
+        let count = samples.len() as f64;
+        let mean = samples.iter().map(|&x| x as f64).sum::<f64>() / count;
+        let variance = samples
+            .iter()
+            .map(|&x| (x as f64 - mean) * (x as f64 - mean))
+            .sum::<f64>()
+            / count;
+        (mean, variance)
+    }
+
+    #[test]
+    fn DiscreteGaussian_samplers_moments() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+
+        // 40000 samples put the standard error of the mean near 0.02 sigma; the bounds are loose
+        // enough never to flake while still catching a wrong width or a biased sign
+        let stddev = 3.0;
+        let cdt = ffi::DiscreteGaussianCDTGen(stddev).unwrap();
+        assert_eq!(cdt.GetStd(), stddev);
+        let mut samples = vec![0i64; 40000];
+        cdt.SampleInto(&mut samples);
+        let (mean, variance) = moments(&samples);
+        assert!(mean.abs() < 0.15, "CDT mean {mean}");
+        assert!(
+            (variance / (stddev * stddev) - 1.0).abs() < 0.1,
+            "CDT variance {variance}"
+        );
+
+        let (karney_mean, karney_stddev) = (5.0, 4.0);
+        ffi::GenerateIntegersKarney(karney_mean, karney_stddev, &mut samples).unwrap();
+        let (mean, variance) = moments(&samples);
+        assert!((mean - karney_mean).abs() < 0.2, "Karney mean {mean}");
+        assert!(
+            (variance / (karney_stddev * karney_stddev) - 1.0).abs() < 0.1,
+            "Karney variance {variance}"
+        );
+
+        // Every tower holds the same small signed coefficients
+        let poly = cdt.SamplePoly(n, size, k_res);
+        assert!(poly.GetFormat() == ffi::Format::EVALUATION);
+        let ring = n as usize;
+        let mut residues = vec![0u64; size * ring];
+        poly.WriteTowersInto(ffi::Format::COEFFICIENT, &mut residues);
+        let basis = ffi::DCRTPolyGenCRTBasis(n, size, k_res);
+        let moduli = basis.GetModuli();
+        for x in 0..ring {
+            let signed = |t: usize| {
+                let r = residues[t * ring + x] as i128;
+                let q = moduli[t] as i128;
+                if r > q / 2 {
+                    r - q
+                } else {
+                    r
+                }
+            };
+            assert!(signed(0).abs() <= (12.0 * stddev).ceil() as i128);
+            for t in 1..size {
+                assert_eq!(signed(t), signed(0));
+            }
+        }
+
+        assert!(ffi::DiscreteGaussianCDTGen(0.0).is_err());
+        assert!(ffi::DiscreteGaussianCDTGen(-1.0).is_err());
+        assert!(ffi::DiscreteGaussianCDTGen(f64::NAN).is_err());
+        assert!(ffi::DiscreteGaussianCDTGen(65536.0 * 2.0).is_err());
+        assert!(ffi::GenerateIntegersKarney(0.0, 0.0, &mut samples).is_err());
+        assert!(ffi::GenerateIntegersKarney(0.0, -2.0, &mut samples).is_err());
+    }
+
+    // Every tower of every entry, in the entry's own format
+    fn matrix_words(matrix: &ffi::Matrix) -> Vec<u64> {
+        let mut words = Vec::new();
+        for i in 0..ffi::GetMatrixRows(matrix) {
+            for j in 0..ffi::GetMatrixCols(matrix) {
+                let entry = MatrixElementRef(matrix, i, j);
+                for t in 0..entry.GetNumOfTowers() {
+                    words.extend_from_slice(entry.GetTowerValues(t));
+                }
+            }
+        }
+        words
+    }
+
+    #[test]
+    fn SeededTrapdoor_preimages_and_reproducible() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let base: i64 = 2;
+        let d: usize = 2;
+        let k = modulus_bits(n, size, k_res);
+        let seed = [7u8; 32];
+
+        let trapdoor = ffi::DCRTSquareMatTrapdoorGenSeeded(
+            n, size, k_res, d, TEST_SIGMA, base, false, &seed, 3,
+        )
+        .unwrap();
+        let public_matrix = trapdoor.GetPublicMatrixRef();
+        let target = random_matrix(n, size, k_res, d, d);
+        let preimage = ffi::DCRTSquareMatTrapdoorGaussSamp(
+            n,
+            k,
+            public_matrix,
+            trapdoor.GetTrapdoorPairRef(),
+            &target,
+            base,
+            TEST_SIGMA,
+        );
+        assert_preimage(public_matrix, &preimage, &target);
+
+        let again = ffi::DCRTSquareMatTrapdoorGenSeeded(
+            n, size, k_res, d, TEST_SIGMA, base, false, &seed, 3,
+        )
+        .unwrap();
+        assert_eq!(
+            matrix_words(public_matrix),
+            matrix_words(again.GetPublicMatrixRef())
+        );
+        let other = ffi::DCRTSquareMatTrapdoorGenSeeded(
+            n, size, k_res, d, TEST_SIGMA, base, false, &seed, 4,
+        )
+        .unwrap();
+        assert_ne!(
+            matrix_words(public_matrix),
+            matrix_words(other.GetPublicMatrixRef())
+        );
+
+        let trapdoor =
+            ffi::DCRTTrapdoorGenSeeded(n, size, k_res, TEST_SIGMA, base, false, &seed, 3).unwrap();
+        let public_matrix = trapdoor.GetPublicMatrixRef();
+        let target = random_matrix(n, size, k_res, 1, 1);
+        let preimage = ffi::DCRTTrapdoorGaussSamp(
+            n,
+            k,
+            public_matrix,
+            trapdoor.GetTrapdoorPairRef(),
+            &MatrixElementRef(&target, 0, 0),
+            base,
+            TEST_SIGMA,
+        );
+        assert_preimage(public_matrix, &preimage, &target);
+
+        // the batch expands stream first_stream + i exactly as the single call does
+        let batch = ffi::DCRTTrapdoorGenBatch(n, size, k_res, TEST_SIGMA, base, false, 2, &seed, 3)
+            .unwrap();
+        assert_eq!(batch.GetSize(), 2);
+        assert_eq!(
+            matrix_words(batch.GetElement(0).GetPublicMatrixRef()),
+            matrix_words(public_matrix)
+        );
+
+        for bad_base in [-1i64, 0, 1] {
+            assert!(ffi::DCRTTrapdoorGenSeeded(
+                n, size, k_res, TEST_SIGMA, bad_base, false, &seed, 3
+            )
+            .is_err());
+            assert!(ffi::DCRTSquareMatTrapdoorGenSeeded(
+                n, size, k_res, d, TEST_SIGMA, bad_base, false, &seed, 3
+            )
+            .is_err());
+            assert!(ffi::DCRTTrapdoorGenBatch(
+                n, size, k_res, TEST_SIGMA, bad_base, false, 2, &seed, 3
+            )
+            .is_err());
+            assert!(ffi::DCRTSquareMatTrapdoorGenBatch(
+                n,
+                size,
+                k_res,
+                d,
+                TEST_SIGMA,
+                bad_base,
+                false,
+                2,
+                &[],
+                0
+            )
+            .is_err());
+        }
+        assert!(ffi::DCRTTrapdoorGenSeeded(
+            n,
+            size,
+            k_res,
+            TEST_SIGMA,
+            base,
+            false,
+            &seed[..16],
+            3
+        )
+        .is_err());
+    }
+
+    #[test]
+    fn SeededMatrix_reproducible_and_roundtrip() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let seed = [11u8; 32];
+
+        let matrix = ffi::MatrixGenFromDugSeeded(n, size, k_res, 2, 3, &seed, 5);
+        let again = ffi::MatrixGenFromDugSeeded(n, size, k_res, 2, 3, &seed, 5);
+        assert_eq!(matrix_words(&matrix), matrix_words(&again));
+        let other = ffi::MatrixGenFromDugSeeded(n, size, k_res, 2, 3, &seed, 6);
+        assert_ne!(matrix_words(&matrix), matrix_words(&other));
+
+        let poly = ffi::DCRTPolyGenFromDugSeeded(n, size, k_res, &seed, 5);
+        assert_eq!(&*MatrixElementRef(&matrix, 0, 0), &*poly);
+
+        let path = std::env::temp_dir()
+            .join(format!("openfhe-seeded-matrix-{}.bin", std::process::id()))
+            .to_string_lossy()
+            .into_owned();
+        ffi::MatrixWriteSeededToFs(n, size, k_res, 2, 3, &seed, 5, &path).unwrap();
+        let loaded = ffi::GetMatrixFromFs(n, size, k_res, &path).unwrap();
+        assert_eq!(matrix_words(&loaded), matrix_words(&matrix));
+        std::fs::remove_file(&path).unwrap();
+    }
+
+    #[test]
+    fn Decompose_into_matches_decompose() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let base_bits: u32 = 7;
+        let matrix = random_matrix(n, size, k_res, 2, 3);
+        let k = MatrixElementRef(&matrix, 0, 0).GetDecomposeLength(base_bits);
+
+        // Decompose's digits (COEFFICIENT format) converted to `format`
+        let expected = |poly: &ffi::DCRTPoly, format: ffi::Format| {
+            let digits = poly.Decompose(base_bits);
+            assert_eq!(ffi::GetMatrixCols(&digits), k);
+            (0..k)
+                .map(|l| {
+                    let mut digit = ffi::GetMatrixElement(&digits, 0, l);
+                    digit.pin_mut().SetFormat(format);
+                    digit
+                })
+                .collect::<Vec<_>>()
+        };
+
+        for format in [ffi::Format::COEFFICIENT, ffi::Format::EVALUATION] {
+            let poly = MatrixElementRef(&matrix, 1, 2);
+            let digits = expected(&*poly, format);
+
+            let mut out = ffi::MatrixGen(n, size, k_res, k + 1, 2);
+            poly.DecomposeInto(base_bits, out.pin_mut(), 1, 1, true, format)
+                .unwrap();
+            for l in 0..k {
+                assert_eq!(&*MatrixElementRef(&out, 1 + l, 1), &*digits[l]);
+            }
+
+            let mut out = ffi::MatrixGen(n, size, k_res, 2, k + 1);
+            poly.DecomposeInto(base_bits, out.pin_mut(), 1, 1, false, format)
+                .unwrap();
+            for l in 0..k {
+                assert_eq!(&*MatrixElementRef(&out, 1, 1 + l), &*digits[l]);
+            }
+
+            let decomposed = ffi::MatrixDecompose(&matrix, base_bits, format).unwrap();
+            assert_eq!(ffi::GetMatrixRows(&decomposed), 2 * k);
+            assert_eq!(ffi::GetMatrixCols(&decomposed), 3);
+            for i in 0..2 {
+                for j in 0..3 {
+                    let digits = expected(&*MatrixElementRef(&matrix, i, j), format);
+                    for l in 0..k {
+                        assert_eq!(&*MatrixElementRef(&decomposed, i * k + l, j), &*digits[l]);
+                    }
+                }
+            }
+        }
+
+        let poly = MatrixElementRef(&matrix, 0, 0);
+        let mut out = ffi::MatrixGen(n, size, k_res, k, 1);
+        let coeff = ffi::Format::COEFFICIENT;
+        assert!(poly
+            .DecomposeInto(base_bits, out.pin_mut(), 0, 0, true, coeff)
+            .is_ok());
+        assert!(poly
+            .DecomposeInto(base_bits, out.pin_mut(), 1, 0, true, coeff)
+            .is_err());
+        assert!(poly
+            .DecomposeInto(base_bits, out.pin_mut(), 0, 1, true, coeff)
+            .is_err());
+        assert!(poly
+            .DecomposeInto(base_bits, out.pin_mut(), usize::MAX, 0, true, coeff)
+            .is_err());
+        assert!(poly
+            .DecomposeInto(base_bits, out.pin_mut(), 0, 0, false, coeff)
+            .is_err());
+        let empty = ffi::MatrixGen(n, size, k_res, 0, 0);
+        assert!(ffi::MatrixDecompose(&empty, base_bits, coeff).is_err());
+    }
+
+    #[test]
+    fn Decompose_into_large_base_bits() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let moduli = ffi::DCRTPolyGenCRTBasis(n, size, k_res)
+            .GetModuli()
+            .to_vec();
+        let mut poly = ffi::DCRTPolyGenFromDug(n, size, k_res);
+        poly.pin_mut().SetFormat(ffi::Format::COEFFICIENT);
+
+        // Digits as wide as, or wider than, a tower: each one is a residue mod q_t, centred and
+        // then reduced into every tower
+        for base_bits in [k_res as u32 - 1, k_res as u32, 40, 63] {
+            let k = poly.GetDecomposeLength(base_bits);
+            let mut out = ffi::MatrixGen(n, size, k_res, k, 1);
+            poly.DecomposeInto(
+                base_bits,
+                out.pin_mut(),
+                0,
+                0,
+                true,
+                ffi::Format::COEFFICIENT,
+            )
+            .unwrap();
+            let mask = (1u64 << base_bits) - 1;
+
+            let mut row = 0;
+            for t in 0..size {
+                let q = moduli[t];
+                let digits = (64 - q.leading_zeros() + base_bits - 1) / base_bits;
+                for j in 0..digits {
+                    let digit = MatrixElementRef(&out, row, 0);
+                    for u in 0..size {
+                        let expected = poly
+                            .GetTowerValues(t)
+                            .iter()
+                            .map(|&x| {
+                                let d = (x >> (j * base_bits)) & mask;
+                                let c = if d > q / 2 {
+                                    d as i128 - q as i128
+                                } else {
+                                    d as i128
+                                };
+                                c.rem_euclid(moduli[u] as i128) as u64
+                            })
+                            .collect::<Vec<_>>();
+                        assert_eq!(digit.GetTowerValues(u), &expected[..]);
+                    }
+                    row += 1;
+                }
+            }
+            assert_eq!(row, k);
+        }
+    }
+
+    #[test]
+    fn MatrixGadgetDecompose_recomposes() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let moduli = ffi::DCRTPolyGenCRTBasis(n, size, k_res)
+            .GetModuli()
+            .to_vec();
+        let matrix = random_matrix(n, size, k_res, 2, 3);
+
+        for base in [2i64, 3, 1 << 8] {
+            // OpenFHE's gadget row for size * D has b^l in tower t at column t * D + l and zero
+            // elsewhere only if D is its own digit count
+            let digits = ffi::GadgetDigitsPerTower(n, size, k_res, base, false).unwrap();
+            let gadget = ffi::DCRTPolyGadgetVector(n, size, k_res, size * digits, base);
+            assert_eq!(ffi::GetMatrixCols(&gadget), size * digits);
+            for t in 0..size {
+                let mut power = 1u128;
+                for l in 0..digits {
+                    let entry = MatrixElementRef(&gadget, 0, t * digits + l);
+                    assert_eq!(entry.GetFormat(), ffi::Format::EVALUATION);
+                    for u in 0..size {
+                        let expected = if u == t {
+                            (power % moduli[t] as u128) as u64
+                        } else {
+                            0
+                        };
+                        assert!(entry.GetTowerValues(u).iter().all(|&v| v == expected));
+                    }
+                    power = power * base as u128 % moduli[t] as u128;
+                }
+            }
+
+            for balanced in [false, true] {
+                let digits = ffi::GadgetDigitsPerTower(n, size, k_res, base, balanced).unwrap();
+                let decomposed = ffi::MatrixGadgetDecompose(&matrix, base, balanced).unwrap();
+                assert_eq!(ffi::GetMatrixRows(&decomposed), 2 * size * digits);
+                let recomposed = ffi::GadgetMulTranspose(&decomposed, base, size * digits).unwrap();
+                assert_eq!(matrix_words(&recomposed), matrix_words(&matrix));
+            }
+        }
+
+        for base in [-1i64, 0, 1, 1 << 31] {
+            assert!(ffi::GadgetDigitsPerTower(n, size, k_res, base, false).is_err());
+            assert!(ffi::MatrixGadgetDecompose(&matrix, base, false).is_err());
+        }
+        let empty = ffi::MatrixGen(n, size, k_res, 0, 0);
+        assert!(ffi::MatrixGadgetDecompose(&empty, 2, false).is_err());
+        let mut mixed = ffi::ExtractMatrixRows(&matrix, 0, 1);
+        let other = ffi::DCRTPolyGenFromConst(n, size, k_res + 1, &[3]);
+        ffi::SetMatrixElement(mixed.pin_mut(), 1, 2, &other);
+        assert!(ffi::MatrixGadgetDecompose(&mixed, 2, true).is_err());
+    }
+
+    #[test]
+    fn GadgetMul_matches_materialised_gadget() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+        let m: usize = 2;
+
+        for base in [2i64, 3, 1 << 8] {
+            let len = size * ffi::GadgetDigitsPerTower(n, size, k_res, base, false).unwrap();
+            let gadget = ffi::DCRTPolyGadgetVector(n, size, k_res, len, base);
+
+            // I_m (x) g
+            let mut gadget_matrix = ffi::MatrixGen(n, size, k_res, m, m * len);
+            for i in 0..m {
+                for l in 0..len {
+                    ffi::SetMatrixElement(
+                        gadget_matrix.pin_mut(),
+                        i,
+                        i * len + l,
+                        &MatrixElementRef(&gadget, 0, l),
+                    );
+                }
+            }
+
+            let left = random_matrix(n, size, k_res, 3, m);
+            assert_eq!(
+                matrix_words(&ffi::GadgetMul(&left, base, len).unwrap()),
+                matrix_words(&ffi::MatrixMul(&left, &gadget_matrix).unwrap())
+            );
+
+            let right = random_matrix(n, size, k_res, m * len, 3);
+            assert_eq!(
+                matrix_words(&ffi::GadgetMulTranspose(&right, base, len).unwrap()),
+                matrix_words(&ffi::MatrixMul(&gadget_matrix, &right).unwrap())
+            );
+        }
+
+        let matrix = random_matrix(n, size, k_res, 2 * size, 2);
+        assert!(ffi::GadgetMul(&matrix, 1, size).is_err());
+        assert!(ffi::GadgetMulTranspose(&matrix, 1, size).is_err());
+        // zero or not a multiple of the tower count; rows not a multiple of len
+        assert!(ffi::GadgetMul(&matrix, 2, 0).is_err());
+        assert!(ffi::GadgetMul(&matrix, 2, size + 1).is_err());
+        assert!(ffi::GadgetMulTranspose(&matrix, 2, 4 * size).is_err());
+        let empty = ffi::MatrixGen(n, size, k_res, 0, 0);
+        assert!(ffi::GadgetMul(&empty, 2, size).is_err());
+        assert!(ffi::GadgetMulTranspose(&empty, 2, size).is_err());
+
+        let mut mixed = ffi::ExtractMatrixRows(&matrix, 0, 1);
+        let mut other = ffi::DCRTPolyGenFromConst(n, size, k_res + 1, &[3]);
+        other.pin_mut().SetFormat(ffi::Format::EVALUATION);
+        ffi::SetMatrixElement(mixed.pin_mut(), 1, 1, &other);
+        assert!(ffi::GadgetMul(&mixed, 2, size).is_err());
+        assert!(ffi::GadgetMulTranspose(&mixed, 2, size).is_err());
+        let mut coefficient = ffi::ExtractMatrixRows(&matrix, 0, 1);
+        ffi::FormatMatrix(coefficient.pin_mut(), ffi::Format::COEFFICIENT);
+        assert!(ffi::GadgetMul(&coefficient, 2, size).is_err());
+        assert!(ffi::GadgetMulTranspose(&coefficient, 2, size).is_err());
+    }
+
+    #[test]
+    fn Serialization_roundtrips_and_rejects_malformed_input() {
+        let _guard = openfhe_test_lock().lock().unwrap();
+        let n: u32 = 8;
+        let size: usize = 2;
+        let k_res: usize = 30;
+
+        for mode in [ffi::SerialMode::BINARY, ffi::SerialMode::JSON] {
+            let poly = ffi::DCRTPolyGenFromDug(n, size, k_res);
+            let bytes = ffi::DCRTPolySerializeToBytes(&poly, mode);
+            assert!(!bytes.is_empty());
+            let loaded = ffi::DCRTPolyDeserializeFromBytes(&bytes, mode);
+            assert!(!loaded.is_null());
+            assert_eq!(loaded.GetFormat(), poly.GetFormat());
+            for t in 0..size {
+                assert_eq!(loaded.GetTowerValues(t), poly.GetTowerValues(t));
+            }
+            assert!(ffi::DCRTPolyDeserializeFromBytes(&bytes[..bytes.len() / 2], mode).is_null());
+            assert!(ffi::DCRTPolyDeserializeFromBytes(&[], mode).is_null());
+
+            let matrix = random_matrix(n, size, k_res, 2, 3);
+            let bytes = ffi::MatrixSerializeToBytes(&matrix, mode);
+            assert!(!bytes.is_empty());
+            let loaded = ffi::MatrixDeserializeFromBytes(n, size, k_res, &bytes, mode);
+            assert!(!loaded.is_null());
+            assert_eq!(ffi::GetMatrixRows(&loaded), 2);
+            assert_eq!(ffi::GetMatrixCols(&loaded), 3);
+            assert_eq!(matrix_words(&loaded), matrix_words(&matrix));
+            assert!(ffi::MatrixDeserializeFromBytes(
+                n,
+                size,
+                k_res,
+                &bytes[..bytes.len() / 2],
+                mode
+            )
+            .is_null());
+
+            let trapdoor = ffi::DCRTTrapdoorGen(n, size, k_res, TEST_SIGMA, 2, false);
+            let pair = trapdoor.GetTrapdoorPairRef();
+            let bytes = ffi::RLWETrapdoorPairSerializeToBytes(pair, mode);
+            assert!(!bytes.is_empty());
+            let loaded = ffi::RLWETrapdoorPairDeserializeFromBytes(n, size, k_res, &bytes, mode);
+            assert!(!loaded.is_null());
+            assert_eq!(ffi::RLWETrapdoorPairSerializeToBytes(&loaded, mode), bytes);
+            let public_matrix = trapdoor.GetPublicMatrixRef();
+            let target = random_matrix(n, size, k_res, 1, 1);
+            let preimage = ffi::DCRTTrapdoorGaussSamp(
+                n,
+                modulus_bits(n, size, k_res),
+                public_matrix,
+                &loaded,
+                &MatrixElementRef(&target, 0, 0),
+                2,
+                TEST_SIGMA,
+            );
+            assert_preimage(public_matrix, &preimage, &target);
+            assert!(ffi::RLWETrapdoorPairDeserializeFromBytes(
+                n,
+                size,
+                k_res,
+                &bytes[..bytes.len() / 2],
+                mode
+            )
+            .is_null());
+        }
+
+        let mut cc_params = ffi::GenParamsBFVRNS();
+        cc_params.pin_mut().SetPlaintextModulus(65537);
+        cc_params.pin_mut().SetMultiplicativeDepth(1);
+        let cc = ffi::DCRTPolyGenCryptoContextByParamsBFVRNS(&cc_params);
+        cc.EnableByFeature(ffi::PKESchemeFeature::PKE);
+        let key_pair = cc.KeyGen();
+
+        let mut values = CxxVector::<i64>::new();
+        for v in [3, 1, 4, 1, 5, 9, 2, 6] {
+            values.pin_mut().push(v);
+        }
+        let plaintext = cc.MakePackedPlaintext(&values, 1, 0);
+        let ciphertext = cc.EncryptByPublicKey(&key_pair.GetPublicKey(), &plaintext);
+
+        for mode in [ffi::SerialMode::BINARY, ffi::SerialMode::JSON] {
+            let bytes = ffi::DCRTPolySerializeCiphertextToBytes(&ciphertext, mode);
+            assert!(!bytes.is_empty());
+            let mut loaded = ffi::DCRTPolyGenNullCiphertext();
+            assert!(ffi::DCRTPolyDeserializeCiphertextFromBytes(
+                &bytes,
+                loaded.pin_mut(),
+                mode
+            ));
+            let mut decrypted = ffi::GenNullPlainText();
+            cc.DecryptByPrivateKeyAndCiphertext(
+                &key_pair.GetPrivateKey(),
+                &loaded,
+                decrypted.pin_mut(),
+            );
+            let decoded: Vec<i64> = decrypted
+                .GetPackedValue()
+                .iter()
+                .take(values.len())
+                .copied()
+                .collect();
+            assert_eq!(decoded, values.iter().copied().collect::<Vec<i64>>());
+
+            let mut malformed = ffi::DCRTPolyGenNullCiphertext();
+            assert!(!ffi::DCRTPolyDeserializeCiphertextFromBytes(
+                &bytes[..bytes.len() / 2],
+                malformed.pin_mut(),
+                mode
+            ));
+        }
+    }
 }